@@ -0,0 +1,249 @@
+/**
+ * @file This file contains a compressed sparse row view of a graph
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"                 // DefaultIdType, Vertex
+#include "graph_concepts.hpp"       // concepts::Graph, concepts::Identifier
+#include "utils/parallel_utils.hpp" // parallel_for
+
+#include <algorithm> // std::sort, std::unique, std::copy
+#include <cstdint>   // size_t
+#include <span>      // std::span
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+// graphxx namespace contains the main features of the graphxx library
+namespace graphxx {
+
+/// @brief Read-only adjacency structure in compressed sparse row format. The
+///        neighbours of every vertex are stored contiguously in a single
+///        vector and `offsets[v]` is the position of the first neighbour of
+///        `v`. Every entry can remember the position of the edge it comes
+///        from in the out edges enumeration of the original graph (vertex by
+///        vertex, in adjacency order), so that edge attributes can be kept in
+///        flat vectors indexed by that position.
+/// @tparam IdType Numeric type representing vertices
+template <concepts::Identifier IdType = DefaultIdType>
+class CompressedSparseRow {
+public:
+  using Vertex = IdType;
+
+  CompressedSparseRow() : _offsets{0} {}
+
+  /// @brief Builds the structure from its raw vectors.
+  /// @param offsets Position of the first neighbour of every vertex, followed
+  /// by the total number of entries.
+  /// @param targets Neighbours of all the vertices.
+  /// @param edge_ids Original edge position of every entry. If empty, the
+  /// position of an entry is also its edge id.
+  CompressedSparseRow(std::vector<size_t> offsets, std::vector<Vertex> targets,
+                      std::vector<size_t> edge_ids = {})
+      : _offsets{std::move(offsets)}, _targets{std::move(targets)},
+        _edge_ids{std::move(edge_ids)} {}
+
+  /// @brief Get number of vertices.
+  /// @return Number of vertices.
+  [[nodiscard]] size_t num_vertices() const { return _offsets.size() - 1; }
+
+  /// @brief Get number of entries, that is the number of edges.
+  /// @return Number of edges.
+  [[nodiscard]] size_t num_edges() const { return _targets.size(); }
+
+  /// @brief Get number of neighbours of a vertex.
+  /// @param vertex Vertex id.
+  /// @return Number of neighbours.
+  [[nodiscard]] size_t degree(Vertex vertex) const {
+    return _offsets[vertex + 1] - _offsets[vertex];
+  }
+
+  /// @brief Retrieves the neighbours of a vertex.
+  /// @param vertex Vertex id.
+  /// @return Contiguous view over the neighbours.
+  std::span<const Vertex> operator[](Vertex vertex) const {
+    return {_targets.data() + _offsets[vertex], degree(vertex)};
+  }
+
+  /// @brief Get the original edge position of an entry.
+  /// @param position Position of the entry in the targets vector.
+  /// @return Position of the edge in the out edges enumeration of the graph.
+  [[nodiscard]] size_t edge_id(size_t position) const {
+    return _edge_ids.empty() ? position : _edge_ids[position];
+  }
+
+  /// @brief Get the offsets vector.
+  const std::vector<size_t> &offsets() const { return _offsets; }
+
+  /// @brief Get the targets vector.
+  const std::vector<Vertex> &targets() const { return _targets; }
+
+private:
+  /// @brief Position of the first neighbour of every vertex.
+  std::vector<size_t> _offsets;
+  /// @brief Neighbours of all the vertices.
+  std::vector<Vertex> _targets;
+  /// @brief Original edge position of every entry, empty for the identity.
+  std::vector<size_t> _edge_ids;
+};
+
+/// @brief Builds the compressed sparse row of the out edges of a graph. The
+/// neighbours keep the adjacency order of the graph, so the position of every
+/// entry is also its edge id.
+/// @tparam G type of the graph
+/// @param graph input graph
+/// @return compressed sparse row of the out edges
+template <concepts::Graph G>
+CompressedSparseRow<Vertex<G>> make_csr(const G &graph) {
+  std::vector<size_t> offsets(graph.num_vertices() + 1, 0);
+  std::vector<Vertex<G>> targets;
+  targets.reserve(graph.num_edges());
+
+  for (Vertex<G> vertex = 0; vertex < graph.num_vertices(); ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      targets.push_back(graph.get_target(edge));
+    }
+    offsets[vertex + 1] = targets.size();
+  }
+
+  return {std::move(offsets), std::move(targets)};
+}
+
+/// @brief Builds the compressed sparse row of the in edges of a graph, with a
+/// counting sort on the targets. The neighbours of a vertex are the sources of
+/// its in edges, in increasing order, and every entry keeps the id of the edge
+/// it comes from.
+/// @tparam G type of the graph
+/// @param graph input graph
+/// @return compressed sparse row of the in edges
+template <concepts::Graph G>
+CompressedSparseRow<Vertex<G>> make_transposed_csr(const G &graph) {
+  size_t num_vertices = graph.num_vertices();
+  std::vector<size_t> offsets(num_vertices + 1, 0);
+
+  for (Vertex<G> vertex = 0; vertex < num_vertices; ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      ++offsets[graph.get_target(edge) + 1];
+    }
+  }
+  for (size_t vertex = 0; vertex < num_vertices; ++vertex) {
+    offsets[vertex + 1] += offsets[vertex];
+  }
+
+  std::vector<Vertex<G>> sources(offsets.back());
+  std::vector<size_t> edge_ids(offsets.back());
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  size_t edge_id = 0;
+
+  for (Vertex<G> vertex = 0; vertex < num_vertices; ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      size_t position = next[graph.get_target(edge)]++;
+      sources[position] = vertex;
+      edge_ids[position] = edge_id++;
+    }
+  }
+
+  return {std::move(offsets), std::move(sources), std::move(edge_ids)};
+}
+
+/// @brief Builds the compressed sparse row of the simple undirected graph
+/// underlying a graph: every edge appears in both directions, self loops and
+/// parallel edges are dropped and the neighbours of every vertex are sorted.
+/// Entries do not keep the edge ids.
+/// @tparam G type of the graph
+/// @param graph input graph
+/// @param num_threads maximum number of threads used to sort the neighbours
+/// @return symmetric compressed sparse row with sorted neighbours
+template <concepts::Graph G>
+CompressedSparseRow<Vertex<G>>
+make_symmetric_csr(const G &graph,
+                   size_t num_threads = utils::default_num_threads()) {
+  size_t num_vertices = graph.num_vertices();
+  std::vector<size_t> offsets(num_vertices + 1, 0);
+
+  for (Vertex<G> vertex = 0; vertex < num_vertices; ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      Vertex<G> target = graph.get_target(edge);
+      if (target != vertex) {
+        ++offsets[vertex + 1];
+        ++offsets[target + 1];
+      }
+    }
+  }
+  for (size_t vertex = 0; vertex < num_vertices; ++vertex) {
+    offsets[vertex + 1] += offsets[vertex];
+  }
+
+  std::vector<Vertex<G>> targets(offsets.back());
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for (Vertex<G> vertex = 0; vertex < num_vertices; ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      Vertex<G> target = graph.get_target(edge);
+      if (target != vertex) {
+        targets[next[vertex]++] = target;
+        targets[next[target]++] = vertex;
+      }
+    }
+  }
+
+  // Sort every list and remember how many distinct neighbours it keeps
+  std::vector<size_t> degrees(num_vertices + 1, 0);
+  utils::parallel_for(
+      size_t{0}, num_vertices,
+      [&](size_t vertex) {
+        auto first = targets.begin() + offsets[vertex];
+        auto last = targets.begin() + offsets[vertex + 1];
+        std::sort(first, last);
+        degrees[vertex + 1] = std::unique(first, last) - first;
+      },
+      num_threads);
+  for (size_t vertex = 0; vertex < num_vertices; ++vertex) {
+    degrees[vertex + 1] += degrees[vertex];
+  }
+
+  // Compact in place: every list moves towards the front, never overlapping
+  // a list still to be moved. Lists already in place are skipped, since copy
+  // does not allow the output to start in the input
+  for (size_t vertex = 0; vertex < num_vertices; ++vertex) {
+    if (degrees[vertex] == offsets[vertex]) {
+      continue;
+    }
+    std::copy(targets.begin() + offsets[vertex],
+              targets.begin() + offsets[vertex] +
+                  (degrees[vertex + 1] - degrees[vertex]),
+              targets.begin() + degrees[vertex]);
+  }
+  targets.resize(degrees.back());
+
+  return {std::move(degrees), std::move(targets)};
+}
+
+} // namespace graphxx
@@ -0,0 +1,258 @@
+/**
+ * @file This file contains the residual graph used by the flow algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"           // Vertex, Edge
+#include "exceptions.hpp"     // exceptions::InvariantViolationException
+#include "graph_concepts.hpp" // concepts::Graph, concepts::Identifier
+
+#include <concepts>   // std::invocable
+#include <cstdint>    // size_t
+#include <functional> // std::function
+#include <limits>     // std::numeric_limits
+#include <tuple>      // std::tuple_element_t
+#include <utility>    // std::declval, std::move
+#include <vector>     // std::vector
+
+// graphxx namespace contains the main features of the graphxx library
+namespace graphxx {
+
+/// @brief Sparse residual network in compressed sparse row format. Every edge
+///        of the original graph becomes a pair of opposite arcs, each one
+///        knowing the position of the other, so pushing flow along an arc is
+///        a constant time update of two residual capacities. The arcs leaving
+///        a vertex are stored contiguously in the range
+///        [first_arc(v), last_arc(v)). Memory is O(V + E), independently of
+///        the number of vertices squared.
+/// @tparam IdType Numeric type representing vertices
+/// @tparam FlowType Numeric type of capacities and flows
+template <concepts::Identifier IdType, concepts::Numeric FlowType>
+class ResidualGraph {
+public:
+  using Vertex = IdType;
+  using Flow = FlowType;
+
+  /// @brief Value of edge_id for the arcs that do not come from an edge.
+  static constexpr size_t NO_EDGE = std::numeric_limits<size_t>::max();
+
+  ResidualGraph() : _offsets{0} {}
+
+  /// @brief Builds the network from its raw vectors.
+  /// @param offsets Position of the first arc of every vertex, followed by
+  /// the total number of arcs.
+  /// @param heads Target vertex of every arc.
+  /// @param reverse Position of the opposite arc of every arc.
+  /// @param capacity Capacity of every arc.
+  /// @param edge_ids Original edge position of every arc, or NO_EDGE.
+  ResidualGraph(std::vector<size_t> offsets, std::vector<Vertex> heads,
+                std::vector<size_t> reverse, std::vector<Flow> capacity,
+                std::vector<size_t> edge_ids)
+      : _offsets{std::move(offsets)}, _heads{std::move(heads)},
+        _reverse{std::move(reverse)}, _capacity{std::move(capacity)},
+        _residual{_capacity}, _edge_ids{std::move(edge_ids)} {}
+
+  /// @brief Get number of vertices.
+  [[nodiscard]] size_t num_vertices() const { return _offsets.size() - 1; }
+
+  /// @brief Get number of arcs, twice the number of edges.
+  [[nodiscard]] size_t num_arcs() const { return _heads.size(); }
+
+  /// @brief Get the position of the first arc leaving a vertex.
+  [[nodiscard]] size_t first_arc(Vertex vertex) const {
+    return _offsets[vertex];
+  }
+
+  /// @brief Get the position after the last arc leaving a vertex.
+  [[nodiscard]] size_t last_arc(Vertex vertex) const {
+    return _offsets[vertex + 1];
+  }
+
+  /// @brief Get the vertex reached by an arc.
+  [[nodiscard]] Vertex head(size_t arc) const { return _heads[arc]; }
+
+  /// @brief Get the position of the opposite arc.
+  [[nodiscard]] size_t reverse(size_t arc) const { return _reverse[arc]; }
+
+  /// @brief Get the initial capacity of an arc.
+  [[nodiscard]] Flow capacity(size_t arc) const { return _capacity[arc]; }
+
+  /// @brief Get the capacity still available on an arc.
+  [[nodiscard]] Flow residual(size_t arc) const { return _residual[arc]; }
+
+  /// @brief Get the flow sent along an arc, negative when the flow goes the
+  /// other way.
+  [[nodiscard]] Flow flow(size_t arc) const {
+    return _capacity[arc] - _residual[arc];
+  }
+
+  /// @brief Get the position of the edge an arc comes from, in the out edges
+  /// enumeration of the original graph (vertex by vertex, in adjacency
+  /// order).
+  /// @return The edge position, or NO_EDGE for the arcs added as reverse.
+  [[nodiscard]] size_t edge_id(size_t arc) const { return _edge_ids[arc]; }
+
+  /// @brief Sends flow along an arc, updating the opposite arc as well.
+  /// @param arc Position of the arc.
+  /// @param amount Flow to send, at most the residual capacity of the arc.
+  void push(size_t arc, Flow amount) {
+    _residual[arc] -= amount;
+    _residual[_reverse[arc]] += amount;
+  }
+
+  /// @brief Removes all the flow, restoring the initial capacities.
+  void reset() { _residual = _capacity; }
+
+private:
+  /// @brief Position of the first arc of every vertex.
+  std::vector<size_t> _offsets;
+  /// @brief Target vertex of every arc.
+  std::vector<Vertex> _heads;
+  /// @brief Position of the opposite arc of every arc.
+  std::vector<size_t> _reverse;
+  /// @brief Initial capacity of every arc.
+  std::vector<Flow> _capacity;
+  /// @brief Available capacity of every arc.
+  std::vector<Flow> _residual;
+  /// @brief Original edge position of every arc.
+  std::vector<size_t> _edge_ids;
+};
+
+namespace detail::residual_graph {
+// Builds the residual network; when pair_undirected is true, the two copies
+// of an undirected edge become a single pair of arcs with the same capacity
+template <bool pair_undirected, concepts::Graph G, typename Flow,
+          typename Capacity>
+ResidualGraph<Vertex<G>, Flow> build(const G &graph, Capacity &capacity) {
+  constexpr bool paired =
+      pair_undirected && G::DIRECTEDNESS == Directedness::UNDIRECTED;
+  size_t num_vertices = graph.num_vertices();
+
+  auto is_arc = [&](const Edge<G> &edge) {
+    Vertex<G> source = graph.get_source(edge);
+    Vertex<G> target = graph.get_target(edge);
+    return paired ? source < target : source != target;
+  };
+
+  std::vector<size_t> offsets(num_vertices + 1, 0);
+  for (Vertex<G> vertex = 0; vertex < num_vertices; ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      if (is_arc(edge)) {
+        ++offsets[vertex + 1];
+        ++offsets[graph.get_target(edge) + 1];
+      }
+    }
+  }
+  for (size_t vertex = 0; vertex < num_vertices; ++vertex) {
+    offsets[vertex + 1] += offsets[vertex];
+  }
+
+  size_t num_arcs = offsets.back();
+  std::vector<Vertex<G>> heads(num_arcs);
+  std::vector<size_t> reverse(num_arcs);
+  std::vector<Flow> capacities(num_arcs);
+  std::vector<size_t> edge_ids(num_arcs);
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  size_t edge_id = 0;
+
+  for (Vertex<G> vertex = 0; vertex < num_vertices; ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      if (is_arc(edge)) {
+        Flow edge_capacity = capacity(edge);
+        if (edge_capacity < 0) {
+          throw exceptions::InvariantViolationException(
+              "negative edge capacity found");
+        }
+
+        Vertex<G> target = graph.get_target(edge);
+        size_t forward = next[vertex]++;
+        size_t backward = next[target]++;
+
+        heads[forward] = target;
+        heads[backward] = vertex;
+        reverse[forward] = backward;
+        reverse[backward] = forward;
+        capacities[forward] = edge_capacity;
+        capacities[backward] = paired ? edge_capacity : Flow{0};
+        edge_ids[forward] = edge_id;
+        edge_ids[backward] = ResidualGraph<Vertex<G>, Flow>::NO_EDGE;
+      }
+      ++edge_id;
+    }
+  }
+
+  return {std::move(offsets), std::move(heads), std::move(reverse),
+          std::move(capacities), std::move(edge_ids)};
+}
+} // namespace detail::residual_graph
+
+/// @brief Builds the residual network of a graph. Every edge of a directed
+/// graph becomes an arc with its capacity and a reverse arc with no capacity;
+/// every edge of an undirected graph becomes two opposite arcs with the same
+/// capacity. Self loops are dropped, since they never carry flow.
+/// @tparam G type of the graph
+/// @tparam Capacity function used to get the capacity of an edge
+/// @tparam Flow type of the capacities
+/// @param graph input graph
+/// @param capacity capacity function
+/// @return the residual network with no flow
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Capacity =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Flow = decltype(std::declval<Capacity>()(Edge<G>{}))>
+ResidualGraph<Vertex<G>, Flow> make_residual_graph(
+    const G &graph,
+    Capacity capacity = [](const Edge<G> &edge) { return std::get<2>(edge); }) {
+  return detail::residual_graph::build<true, G, Flow>(graph, capacity);
+}
+
+/// @brief Builds the residual network of a graph, treating every stored edge
+/// as directed: each copy of an undirected edge gets its own arc and reverse
+/// arc with no capacity. This is the representation needed when arcs also
+/// have a cost, since sending flow back along a reverse arc must refund it.
+/// @tparam G type of the graph
+/// @tparam Capacity function used to get the capacity of an edge
+/// @tparam Flow type of the capacities
+/// @param graph input graph
+/// @param capacity capacity function
+/// @return the residual network with no flow
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Capacity =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Flow = decltype(std::declval<Capacity>()(Edge<G>{}))>
+ResidualGraph<Vertex<G>, Flow> make_directed_residual_graph(
+    const G &graph,
+    Capacity capacity = [](const Edge<G> &edge) { return std::get<2>(edge); }) {
+  return detail::residual_graph::build<false, G, Flow>(graph, capacity);
+}
+
+} // namespace graphxx
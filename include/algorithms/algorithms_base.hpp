@@ -32,6 +32,10 @@
 
 #pragma once
 
+#include "base.hpp" // Vertex, Edge
+
+#include <concepts> // std::convertible_to
+
 /// algorithms namespace contains all the algorithms available and related support structures
 namespace graphxx::algorithms {
 
@@ -42,4 +46,69 @@ enum class VertexStatus {
   PROCESSED,
 };
 
-} // namespace graphxx::algorithms
\ No newline at end of file
+/// @brief Value returned by every visitor event in order to drive the visit
+enum class VisitorAction {
+  /// @brief Go on with the visit
+  CONTINUE,
+  /// @brief Do not expand the current vertex or do not follow the current edge
+  SKIP,
+  /// @brief Terminate the visit immediately
+  STOP,
+};
+
+/// @brief Visitor that does nothing and never stops the visit. Custom visitors
+/// can inherit from it and redefine only the events they are interested in.
+struct DefaultVisitor {
+  /// @brief Called the first time a vertex is reached
+  VisitorAction discover_vertex(const auto &) {
+    return VisitorAction::CONTINUE;
+  }
+  /// @brief Called on every out edge of the vertex being expanded
+  VisitorAction examine_edge(const auto &) { return VisitorAction::CONTINUE; }
+  /// @brief Called on every edge that reaches an undiscovered vertex
+  VisitorAction tree_edge(const auto &) { return VisitorAction::CONTINUE; }
+  /// @brief Called when all the out edges of a vertex have been examined
+  VisitorAction finish_vertex(const auto &) {
+    return VisitorAction::CONTINUE;
+  }
+};
+
+namespace detail {
+/// @brief Adapts a plain callback, called once per discovered vertex, to the
+/// visitor interface
+/// @tparam Callback type of the wrapped callable
+template <typename Callback> struct CallbackVisitor : DefaultVisitor {
+  Callback &callback;
+
+  explicit CallbackVisitor(Callback &function) : callback{function} {}
+
+  VisitorAction discover_vertex(const auto &vertex) {
+    callback(vertex);
+    return VisitorAction::CONTINUE;
+  }
+};
+} // namespace detail
+
+} // namespace graphxx::algorithms
+
+/// concepts namespace contains all the concepts used by the library
+namespace graphxx::concepts {
+
+/// @brief Check if type is a visitor for the traversals of graph type G
+template <typename V, typename G>
+concept Visitor = requires(V visitor, Vertex<G> vertex, Edge<G> edge) {
+  {
+    visitor.discover_vertex(vertex)
+    } -> std::convertible_to<algorithms::VisitorAction>;
+  {
+    visitor.examine_edge(edge)
+    } -> std::convertible_to<algorithms::VisitorAction>;
+  {
+    visitor.tree_edge(edge)
+    } -> std::convertible_to<algorithms::VisitorAction>;
+  {
+    visitor.finish_vertex(vertex)
+    } -> std::convertible_to<algorithms::VisitorAction>;
+};
+
+} // namespace graphxx::concepts
\ No newline at end of file
@@ -0,0 +1,138 @@
+/**
+ * @file This file is the header of the betweenness centrality algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"                 // Vertex, Edge
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // default_num_threads
+
+#include <concepts>   // std::invocable
+#include <cstdint>    // size_t
+#include <functional> // std::function
+#include <tuple>      // std::tuple_element_t
+#include <utility>    // std::declval
+#include <vector>     // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Parallel implementation of Brandes algorithm for the betweenness
+/// centrality of an unweighted graph, in O(VE). A BFS from every source
+/// counts the shortest paths reaching every vertex, then the dependencies are
+/// accumulated walking the visit order backwards. Sources are distributed
+/// among the threads, each one with its own workspace and centrality
+/// accumulator, which are summed at the end. For undirected graphs every
+/// path is counted once, as the halved sum over all the sources.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param num_threads maximum number of threads to use
+/// @return the betweenness centrality of every vertex, not normalized
+template <concepts::Graph G>
+std::vector<double>
+betweenness_centrality(const G &graph,
+                       size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel implementation of Brandes algorithm for the betweenness
+/// centrality of a weighted graph, in O(VE + V^2 log V). Shortest paths are
+/// counted by a Dijkstra visit from every source on an indexed heap.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of distance among the nodes
+/// @param graph input graph
+/// @param weight weight function
+/// @param num_threads maximum number of threads to use
+/// @throws InvariantViolationException if an edge weight is not positive
+/// @return the betweenness centrality of every vertex, not normalized
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+std::vector<double> weighted_betweenness_centrality(
+    const G &graph,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); },
+    size_t num_threads = utils::default_num_threads());
+
+/// @brief Approximate betweenness centrality of an unweighted graph, running
+/// Brandes algorithm only from a uniform sample of distinct sources and
+/// scaling the dependencies by the inverse sampling rate, which makes the
+/// estimates unbiased. See betweenness_sample_size for the number of
+/// samples guaranteeing a given error.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param num_samples number of sources, all of them when not smaller than
+/// the number of vertices
+/// @param seed seed of the random sampling
+/// @param num_threads maximum number of threads to use
+/// @return the estimated betweenness centrality of every vertex
+template <concepts::Graph G>
+std::vector<double> approximate_betweenness_centrality(
+    const G &graph, size_t num_samples, unsigned int seed = 0,
+    size_t num_threads = utils::default_num_threads());
+
+/// @brief Approximate betweenness centrality of a weighted graph, running
+/// Brandes algorithm only from a uniform sample of distinct sources.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of distance among the nodes
+/// @param graph input graph
+/// @param num_samples number of sources, all of them when not smaller than
+/// the number of vertices
+/// @param weight weight function
+/// @param seed seed of the random sampling
+/// @param num_threads maximum number of threads to use
+/// @throws InvariantViolationException if an edge weight is not positive
+/// @return the estimated betweenness centrality of every vertex
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+std::vector<double> approximate_weighted_betweenness_centrality(
+    const G &graph, size_t num_samples,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); },
+    unsigned int seed = 0, size_t num_threads = utils::default_num_threads());
+
+/// @brief Number of sources to sample so that, with probability at least
+/// 1 - delta, the approximate betweenness of every vertex differs from the
+/// exact one by less than epsilon * n * (n - 2), for a graph of n vertices.
+/// The dependency of a vertex on a source is at most n - 2, so the bound
+/// follows from Hoeffding inequality and a union bound over the vertices.
+/// @param num_vertices number of vertices of the graph
+/// @param epsilon maximum error, relative to n * (n - 2)
+/// @param delta maximum probability of exceeding the error
+/// @return the number of sources to sample
+inline size_t betweenness_sample_size(size_t num_vertices, double epsilon,
+                                      double delta);
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/betweenness.i.hpp"
@@ -32,13 +32,13 @@
 
 #pragma once
 
-#include "algorithms_base.hpp" // VertexStatus
+#include "algorithms_base.hpp" // VertexStatus, Visitor
 #include "base.hpp"            // Vertex
 #include "graph_concepts.hpp"  // Graph
 
-#include <cstdint>    // size_t
-#include <functional> // std::function
-#include <vector>     // std::vector
+#include <concepts> // std::invocable
+#include <cstdint>  // size_t
+#include <vector>   // std::vector
 
 /// algorithms namespace contains all the algorithms available and related support structures
 namespace graphxx::algorithms {
@@ -71,14 +71,30 @@ std::vector<BfsNode<Vertex<G>>> bfs(const G &graph, Vertex<G> source);
 ///        visiting vertices that are further away. For each visited node
 ///        function `callback` is called.
 /// @tparam G type of input graph
+/// @tparam Callback type of the function called on every visited vertex
 /// @param graph graph on which the algorithm will run
 /// @param source starting vertex
 /// @param callback function to call when a new node is visited
 /// @return a vector composed by BfsNode structs
-template <concepts::Graph G>
-std::vector<BfsNode<Vertex<G>>>
-bfs(const G &graph, Vertex<G> source,
-    const std::function<void(Vertex<G>)> &callback);
+template <concepts::Graph G, std::invocable<Vertex<G>> Callback>
+std::vector<BfsNode<Vertex<G>>> bfs(const G &graph, Vertex<G> source,
+                                    Callback &&callback);
+
+/// @brief Performs a breadth-first traversal of a graph driven by a visitor.
+///        The visitor events are resolved at compile time, so they can be
+///        inlined. Returning VisitorAction::SKIP from discover_vertex prevents
+///        the vertex from being expanded, from examine_edge or tree_edge it
+///        ignores the edge. Returning VisitorAction::STOP from any event ends
+///        the visit, leaving the remaining vertices untouched.
+/// @tparam G type of input graph
+/// @tparam Visitor type of the visitor
+/// @param graph graph on which the algorithm will run
+/// @param source starting vertex
+/// @param visitor visitor notified of the traversal events
+/// @return a vector composed by BfsNode structs
+template <concepts::Graph G, concepts::Visitor<G> Visitor>
+std::vector<BfsNode<Vertex<G>>> bfs(const G &graph, Vertex<G> source,
+                                    Visitor &&visitor);
 
 } // namespace graphxx::algorithms
 
@@ -0,0 +1,96 @@
+/**
+ * @file This file is the header of the biconnected components algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "base.hpp"                           // Directedness
+#include "graph_concepts.hpp"                 // Graph, Identifier
+
+#include <cstdint> // size_t
+#include <limits>  // std::numeric_limits
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Biconnected components, articulation points and bridges of an
+/// undirected graph, as flat arrays indexed by vertex or by entry of the
+/// compressed sparse row, which holds every edge in both directions.
+struct BiconnectedComponents {
+  /// @brief Component of the self loops, which belong to none
+  static constexpr size_t NO_COMPONENT = std::numeric_limits<size_t>::max();
+
+  /// @brief Biconnected component of every entry, numbered from zero, the
+  /// same for both entries of an edge
+  std::vector<size_t> edge_component;
+  /// @brief Number of biconnected components
+  size_t num_components;
+  /// @brief True for the vertices whose removal disconnects their component
+  std::vector<bool> articulation_point;
+  /// @brief True for the entries of the edges whose removal disconnects their
+  /// component
+  std::vector<bool> bridge;
+};
+
+/// @brief Implementation of Hopcroft-Tarjan algorithm, in O(V + E). A depth
+/// first visit with an explicit stack, so that it does not overflow the call
+/// stack on deep graphs, computes the discovery time of every vertex and the
+/// lowest discovery time reachable from its subtree with one back edge. The
+/// edge to the parent is skipped once, so parallel edges are back edges. A
+/// tree edge to a child whose low link is not below its parent starts a new
+/// component, and every other edge belongs to the component of the tree edge
+/// entering its deeper endpoint, so no stack of edges is kept.
+/// @tparam Id type of the vertices
+/// @param symmetric compressed sparse row holding every edge in both
+/// directions, as built by make_csr on an undirected graph or by
+/// make_symmetric_csr
+/// @return the components of the entries, the articulation points and the
+/// bridges
+template <concepts::Identifier Id>
+BiconnectedComponents
+biconnected_components(const CompressedSparseRow<Id> &symmetric);
+
+/// @brief Biconnected components of an undirected graph. Entries are the
+/// edges in the out edges enumeration of the graph (vertex by vertex, in
+/// adjacency order), so both directions of every edge are included.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @return the components of the edges, the articulation points and the
+/// bridges
+template <concepts::Graph G>
+requires(G::DIRECTEDNESS == Directedness::UNDIRECTED)
+BiconnectedComponents biconnected_components(const G &graph);
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/biconnected_components.i.hpp"
@@ -0,0 +1,77 @@
+/**
+ * @file This file is the header of the parallel Boruvka algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"                 // Edge
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // default_num_threads
+
+#include <concepts>   // std::invocable
+#include <cstdint>    // size_t
+#include <functional> // std::function
+#include <tuple>      // std::tuple_element_t
+#include <utility>    // std::declval
+#include <vector>     // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Parallel implementation of Boruvka algorithm. At every round, each
+/// component selects in parallel its lightest outgoing edge, ties broken by
+/// edge position so that the choices never form a cycle. The selected edges
+/// are added to the forest, the components they connect are merged by
+/// hooking and pointer jumping, and the edges that became internal to a
+/// component are dropped. The number of components at least halves at every
+/// round, so there are O(log V) rounds of O(E) parallel work. Edges are
+/// treated as undirected, like in kruskal: each edge of an undirected graph is
+/// considered once and self loops are skipped. The weight function can be
+/// called concurrently by several threads.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of distance among the nodes
+/// @param graph graph on which the algorithm will run
+/// @param weight weight function
+/// @param num_threads maximum number of threads to use
+/// @return a vector of edges, in increasing weight order
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+std::vector<Edge<G>> boruvka(
+    const G &graph,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); },
+    size_t num_threads = utils::default_num_threads());
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/boruvka.i.hpp"
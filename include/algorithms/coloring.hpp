@@ -0,0 +1,114 @@
+/**
+ * @file This file is the header of the vertex coloring algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "graph_concepts.hpp"                 // Graph, Identifier
+#include "utils/parallel_utils.hpp"           // default_num_threads
+
+#include <cstdint> // size_t
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Order in which the greedy coloring visits the vertices
+enum class ColoringOrder {
+  /// @brief By non increasing degree
+  LARGEST_FIRST,
+  /// @brief Reverse of the order of removal of a vertex of minimum degree,
+  /// using at most one color more than the degeneracy of the graph
+  SMALLEST_LAST
+};
+
+/// @brief Proper vertex coloring of a graph: adjacent vertices have
+/// different colors, so the vertices of a color can be updated concurrently.
+struct Coloring {
+  /// @brief Color of every vertex, numbered from zero
+  std::vector<size_t> color;
+  /// @brief Number of colors used
+  size_t num_colors;
+};
+
+/// @brief Serial greedy coloring: the vertices are visited in the given order
+/// and every vertex takes the smallest color not used by its neighbours, in
+/// O(V + E) for the smallest last order and O(V log V + E) for the largest
+/// first order.
+/// @tparam Id type of the vertices
+/// @param symmetric symmetric compressed sparse row, without self loops and
+/// parallel edges, as built by make_symmetric_csr
+/// @param order order in which the vertices are colored
+/// @return the coloring, with at most one color more than the maximum degree
+template <concepts::Identifier Id>
+Coloring greedy_coloring(const CompressedSparseRow<Id> &symmetric,
+                         ColoringOrder order = ColoringOrder::SMALLEST_LAST);
+
+/// @brief Serial greedy coloring of a graph, ignoring the direction of the
+/// edges, self loops and parallel edges.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param order order in which the vertices are colored
+/// @return the coloring, with at most one color more than the maximum degree
+template <concepts::Graph G>
+Coloring greedy_coloring(const G &graph,
+                         ColoringOrder order = ColoringOrder::SMALLEST_LAST);
+
+/// @brief Parallel speculative coloring (Gebremedhin-Manne). In every round
+/// the threads color the vertices of a worklist concurrently, each taking the
+/// smallest color not used by its neighbours at the time, then the vertices
+/// having a neighbour of smaller id with the same color form the worklist of
+/// the next round. Only vertices colored in the same round can conflict, and
+/// the smallest vertex of every conflict keeps its color, so the worklist
+/// shrinks every round. The result depends on the scheduling of the threads.
+/// @tparam Id type of the vertices
+/// @param symmetric symmetric compressed sparse row, without self loops and
+/// parallel edges, as built by make_symmetric_csr
+/// @param num_threads maximum number of threads to use
+/// @return the coloring, with at most one color more than the maximum degree
+template <concepts::Identifier Id>
+Coloring parallel_coloring(const CompressedSparseRow<Id> &symmetric,
+                           size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel speculative coloring of a graph, ignoring the direction of
+/// the edges, self loops and parallel edges.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param num_threads maximum number of threads to use
+/// @return the coloring, with at most one color more than the maximum degree
+template <concepts::Graph G>
+Coloring parallel_coloring(const G &graph,
+                           size_t num_threads = utils::default_num_threads());
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/coloring.i.hpp"
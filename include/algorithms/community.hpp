@@ -0,0 +1,134 @@
+/**
+ * @file This file is the header of the community detection algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"                 // Vertex, Edge
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // default_num_threads
+
+#include <concepts>   // std::invocable
+#include <cstdint>    // size_t
+#include <functional> // std::function
+#include <tuple>      // std::tuple_element_t
+#include <utility>    // std::declval
+#include <vector>     // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Partition of the vertices of a graph in communities.
+/// @tparam Id type of vertices identifier
+template <concepts::Identifier Id> struct Communities {
+  /// @brief Community of every vertex, numbered from zero
+  std::vector<Id> community;
+  /// @brief Number of communities
+  size_t num_communities;
+  /// @brief Modularity of the partition
+  double modularity;
+};
+
+/// @brief Parallel asynchronous label propagation. Every vertex starts in its
+/// own community, then repeatedly takes the label with the largest total
+/// weight among its neighbours, keeping its own label on ties and otherwise
+/// breaking them by a hash of the labels salted with the vertex. Labels are
+/// updated in place while the threads sweep their vertex ranges, so later
+/// vertices see the new labels immediately, until a sweep changes no label.
+/// Directed graphs are treated as undirected. The result depends on the
+/// scheduling of the threads.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of the edge weights
+/// @param graph input graph
+/// @param weight weight function
+/// @param max_iterations maximum number of sweeps
+/// @param num_threads maximum number of threads to use
+/// @throws InvariantViolationException if an edge weight is negative
+/// @return the communities found and their modularity
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+Communities<Vertex<G>> label_propagation(
+    const G &graph,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); },
+    size_t max_iterations = 100,
+    size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel multilevel Louvain method for modularity maximization.
+/// At every level, vertices move concurrently to the neighbouring community
+/// with the largest modularity gain, updating the community weights
+/// atomically; two singletons only merge into the smaller id, so that they
+/// do not swap forever. Then every community is contracted into a vertex,
+/// with the weights between communities summed up in parallel, and the next
+/// level starts on the coarse graph, until no vertex moves. Directed graphs
+/// are treated as undirected.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of the edge weights
+/// @param graph input graph
+/// @param weight weight function
+/// @param num_threads maximum number of threads to use
+/// @throws InvariantViolationException if an edge weight is negative
+/// @return the communities found and their modularity
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+Communities<Vertex<G>> louvain(
+    const G &graph,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); },
+    size_t num_threads = utils::default_num_threads());
+
+/// @brief Modularity of a partition of a graph, treated as undirected: the
+/// fraction of the edge weight inside the communities, minus the expected
+/// fraction if the edges were placed at random keeping the weighted degrees.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of the edge weights
+/// @param graph input graph
+/// @param community community of every vertex, smaller than the number of
+/// vertices
+/// @param weight weight function
+/// @throws InvariantViolationException if an edge weight is negative
+/// @return the modularity, zero for graphs without edges
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+double modularity(
+    const G &graph, const std::vector<Vertex<G>> &community,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); });
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/community.i.hpp"
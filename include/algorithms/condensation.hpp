@@ -0,0 +1,125 @@
+/**
+ * @file This file is the header of the graph condensation
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "algorithms/parallel_scc.hpp"        // SCCComponents
+#include "base.hpp"                           // Vertex
+#include "graph_concepts.hpp"                 // Graph
+
+#include <concepts>   // std::invocable
+#include <cstdint>    // size_t
+#include <functional> // std::function
+#include <tuple>      // std::tuple_element_t
+#include <utility>    // std::declval
+#include <vector>     // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Graph obtained by contracting every component into a single vertex.
+/// There is an edge between two components when at least one edge of the
+/// original graph goes from the first to the second one; edges inside a
+/// component are dropped.
+/// @tparam Id type of vertices identifier
+template <concepts::Identifier Id> struct Condensation {
+  /// @brief Edges between components, without duplicates and with the
+  /// targets of every component in increasing order
+  CompressedSparseRow<Id> graph;
+  /// @brief Number of edges of the original graph merged into every edge
+  std::vector<size_t> multiplicity;
+};
+
+/// @brief Condensation keeping track of the lightest edge of the original
+/// graph merged into every edge.
+/// @tparam Id type of vertices identifier
+/// @tparam Distance type of the weights
+template <concepts::Identifier Id, concepts::Numeric Distance>
+struct WeightedCondensation {
+  /// @brief Edges between components, without duplicates and with the
+  /// targets of every component in increasing order
+  CompressedSparseRow<Id> graph;
+  /// @brief Number of edges of the original graph merged into every edge
+  std::vector<size_t> multiplicity;
+  /// @brief Minimum weight among the edges merged into every edge
+  std::vector<Distance> min_weight;
+};
+
+/// @brief Builds the condensation of a graph given the component of every
+/// vertex, in O(V + E). The edges between components are grouped with two
+/// counting sort passes, by target and then by source, so that duplicates end
+/// up next to each other and are merged with a linear scan, without hashing.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param component id of the component of every vertex
+/// @param num_components number of components
+/// @return the condensed graph with the multiplicity of every edge
+template <concepts::Graph G>
+Condensation<Vertex<G>> condensation(const G &graph,
+                                     const std::vector<Vertex<G>> &component,
+                                     size_t num_components);
+
+/// @brief Builds the condensation of a graph from its strongly connected
+/// components, as returned by parallel_scc or to_scc_components. The result
+/// is a directed acyclic graph.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param components strongly connected components of the graph
+/// @return the condensed graph with the multiplicity of every edge
+template <concepts::Graph G>
+Condensation<Vertex<G>>
+condensation(const G &graph, const SCCComponents<Vertex<G>> &components);
+
+/// @brief Builds the condensation of a graph given the component of every
+/// vertex, aggregating the minimum weight of the merged edges.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of the weights
+/// @param graph input graph
+/// @param component id of the component of every vertex
+/// @param num_components number of components
+/// @param weight weight function
+/// @return the condensed graph with the multiplicity and the minimum weight of
+/// every edge
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+WeightedCondensation<Vertex<G>, Distance> weighted_condensation(
+    const G &graph, const std::vector<Vertex<G>> &component,
+    size_t num_components,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); });
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/condensation.i.hpp"
@@ -0,0 +1,65 @@
+/**
+ * @file This file is the header of the parallel connected components algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"                 // Vertex
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // default_num_threads
+
+#include <cstdint> // size_t
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Parallel computation of the connected components, following the
+/// Afforest scheme on a lock-free union-find. First, every vertex is united
+/// with its first neighbours only, which is usually enough to build most of
+/// the giant component. Then the most frequent component is estimated by
+/// sampling, and only the vertices outside of it process the rest of their
+/// edges. Directed graphs are treated as undirected, so the result are their
+/// weakly connected components; for them, the in edges of the vertices outside
+/// the giant component are processed too.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param num_threads maximum number of threads to use
+/// @return the label of the component of every vertex, which is the smallest
+/// vertex of the component
+template <concepts::Graph G>
+std::vector<Vertex<G>>
+connected_components(const G &graph,
+                     size_t num_threads = utils::default_num_threads());
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/connected_components.i.hpp"
@@ -0,0 +1,93 @@
+/**
+ * @file This file is the header of the shortest and longest paths algorithms for directed acyclic graphs
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "algorithms/dijkstra.hpp" // DijkstraNode
+#include "base.hpp"                // Vertex, Edge
+#include "graph_concepts.hpp"      // Graph
+
+#include <concepts>   // std::invocable
+#include <functional> // std::function
+#include <tuple>      // std::tuple_element_t
+#include <utility>    // std::declval
+#include <vector>     // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Single source shortest paths of a directed acyclic graph, in
+/// O(V + E). The out edges of every vertex reachable from the source are
+/// relaxed once, in topological order, so no priority queue is needed and
+/// negative weights are allowed.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of distance among the nodes
+/// @param graph graph on which the algorithm will run
+/// @param source starting vertex
+/// @param weight weight function
+/// @throws InvariantViolationException if the graph has a cycle
+/// @return a vector composed by DijkstraNode structs, where the vertices not
+/// reachable from the source have the largest distance and INVALID_VERTEX as
+/// parent
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+std::vector<DijkstraNode<Vertex<G>, Distance>> dag_shortest_paths(
+    const G &graph, Vertex<G> source,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); });
+
+/// @brief Single source longest paths of a directed acyclic graph, in
+/// O(V + E), relaxing the out edges of every vertex reachable from the source
+/// in topological order. Useful for the critical paths of dependency graphs.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of distance among the nodes
+/// @param graph graph on which the algorithm will run
+/// @param source starting vertex
+/// @param weight weight function
+/// @throws InvariantViolationException if the graph has a cycle
+/// @return a vector composed by DijkstraNode structs, where the vertices not
+/// reachable from the source have the lowest distance and INVALID_VERTEX as
+/// parent
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+std::vector<DijkstraNode<Vertex<G>, Distance>> dag_longest_paths(
+    const G &graph, Vertex<G> source,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); });
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/dag_paths.i.hpp"
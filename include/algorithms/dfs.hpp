@@ -32,12 +32,13 @@
 
 #pragma once
 
-#include "algorithms_base.hpp" // VertexStatus
+#include "algorithms_base.hpp" // VertexStatus, Visitor
 #include "base.hpp"            // Vertex
 #include "graph_concepts.hpp"  // Graph
 
-#include <functional> // std::function
-#include <vector>     // std::vector
+#include <concepts> // std::invocable
+#include <utility>  // std::declval
+#include <vector>   // std::vector
 
 /// algorithms namespace contains all the algorithms available and related support structures
 namespace graphxx::algorithms {
@@ -53,11 +54,53 @@ template <concepts::Identifier Id> struct DfsNode {
   /// @brief Id of the predecessor vertex in the visited tree
   Id parent;
   /// @brief Counter indicating when the vertex is discovered
-  int32_t discovery_time;
+  Id discovery_time;
   /// @brief Counter indicating when the processing of the vertex is finished
-  int32_t finishing_time;
+  Id finishing_time;
 };
 
+/// @brief Type of the iterators over the out edges of a vertex
+/// @tparam G type of the graph
+template <concepts::Graph G>
+using OutEdgeIterator =
+    decltype(std::declval<const G &>()[std::declval<Vertex<G>>()].begin());
+
+/// @brief Frame of the explicit stack used by the iterative depth-first visit:
+/// the vertex being expanded and the position reached among its out edges
+/// @tparam G type of the graph
+template <concepts::Graph G> struct DfsFrame {
+  /// @brief Vertex being expanded
+  Vertex<G> vertex;
+  /// @brief Next out edge to examine
+  OutEdgeIterator<G> current;
+  /// @brief End of the out edges
+  OutEdgeIterator<G> end;
+};
+
+/// @brief Explicit stack of the iterative depth-first visit. It can be reused
+/// by consecutive visits to avoid reallocating it.
+/// @tparam G type of the graph
+template <concepts::Graph G> using DfsStack = std::vector<DfsFrame<G>>;
+
+/// @brief Iterative core of the depth-first traversal. Visits all the vertices
+/// reachable from `source` that are still READY in `distance_tree`, without
+/// recursion, so the depth of the visit is only bounded by the memory.
+/// Discovery and finishing times continue from `time`, so the function can be
+/// called once per root to build a depth-first forest.
+/// @tparam G type of input graph
+/// @tparam Visitor type of the visitor
+/// @param graph graph on which the algorithm will run
+/// @param source starting vertex
+/// @param visitor visitor notified of the traversal events
+/// @param distance_tree flatten tree updated by the visit
+/// @param time last used timestamp, updated by the visit
+/// @param stack explicit stack of frames, reused across calls
+/// @return false if the visitor stopped the visit, true otherwise
+template <concepts::Graph G, concepts::Visitor<G> Visitor>
+bool depth_first_visit(const G &graph, Vertex<G> source, Visitor &&visitor,
+                       std::vector<DfsNode<Vertex<G>>> &distance_tree,
+                       Vertex<G> &time, DfsStack<G> &stack);
+
 /// @brief Performs a depth-first traversal of the graph. A depth-first
 ///        traversal chooses a vertex adjacent to the current vertex to visit
 ///        next. If all adjacent vertices have already been discovered, or there
@@ -77,14 +120,52 @@ std::vector<DfsNode<Vertex<G>>> dfs(const G &graph, Vertex<G> source);
 ///        vertex that had undiscovered neighbors. For each visited node
 ///        function `callback` is called.
 /// @tparam G type of input graph
+/// @tparam Callback type of the function called on every visited vertex
 /// @param graph graph on which the algorithm will run
 /// @param source starting vertex
 /// @param callback function to call when a new node is visited
 /// @return flatten tree composed by DfsNode structs
+template <concepts::Graph G, std::invocable<Vertex<G>> Callback>
+std::vector<DfsNode<Vertex<G>>> dfs(const G &graph, Vertex<G> source,
+                                    Callback &&callback);
+
+/// @brief Performs a depth-first traversal of the graph driven by a visitor.
+///        The visitor events are resolved at compile time, so they can be
+///        inlined. Returning VisitorAction::SKIP from discover_vertex prevents
+///        the vertex from being expanded, from examine_edge or tree_edge it
+///        ignores the edge. Returning VisitorAction::STOP from any event ends
+///        the visit, leaving the remaining vertices untouched.
+/// @tparam G type of input graph
+/// @tparam Visitor type of the visitor
+/// @param graph graph on which the algorithm will run
+/// @param source starting vertex
+/// @param visitor visitor notified of the traversal events
+/// @return flatten tree composed by DfsNode structs
+template <concepts::Graph G, concepts::Visitor<G> Visitor>
+std::vector<DfsNode<Vertex<G>>> dfs(const G &graph, Vertex<G> source,
+                                    Visitor &&visitor);
+
+/// @brief Performs a depth-first traversal of the whole graph. Each vertex not
+///        yet reached by a previous visit, taken in increasing id order, is
+///        used as the root of a new depth-first tree.
+/// @tparam G type of input graph
+/// @param graph graph on which the algorithm will run
+/// @return flatten forest composed by DfsNode structs
 template <concepts::Graph G>
-std::vector<DfsNode<Vertex<G>>>
-dfs(const G &graph, Vertex<G> source,
-    const std::function<void(Vertex<G>)> &callback);
+std::vector<DfsNode<Vertex<G>>> dfs_forest(const G &graph);
+
+/// @brief Performs a depth-first traversal of the whole graph driven by a
+///        visitor. Each vertex not yet reached by a previous visit, taken in
+///        increasing id order, is used as the root of a new depth-first tree.
+///        Returning VisitorAction::STOP from any event ends the whole
+///        traversal.
+/// @tparam G type of input graph
+/// @tparam Visitor type of the visitor
+/// @param graph graph on which the algorithm will run
+/// @param visitor visitor notified of the traversal events
+/// @return flatten forest composed by DfsNode structs
+template <concepts::Graph G, concepts::Visitor<G> Visitor>
+std::vector<DfsNode<Vertex<G>>> dfs_forest(const G &graph, Visitor &&visitor);
 
 } // namespace graphxx::algorithms
 
@@ -0,0 +1,126 @@
+/**
+ * @file This file is the header of the diameter and eccentricity algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "graph_concepts.hpp"                 // Graph, Identifier
+
+#include <cstdint> // size_t
+#include <limits>  // std::numeric_limits
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Bounds on the eccentricity of every vertex, that is the largest
+/// number of edges on a shortest path from the vertex to a vertex of its
+/// connected component.
+struct EccentricityBounds {
+  /// @brief Lower bound on the eccentricity of every vertex
+  std::vector<size_t> lower;
+  /// @brief Upper bound on the eccentricity of every vertex, the maximum
+  /// size_t for the vertices not bounded yet
+  std::vector<size_t> upper;
+  /// @brief Number of breadth first searches performed
+  size_t num_sweeps;
+};
+
+/// @brief Implementation of the bounding eccentricities algorithm of Takes
+/// and Kosters. A breadth first search from a vertex v gives its eccentricity
+/// e(v), and by the triangle inequality every vertex w at distance d(v, w)
+/// has eccentricity between max(e(v) - d(v, w), d(v, w)) and e(v) + d(v, w).
+/// Vertices whose bounds meet are dropped, and the next source alternates
+/// between the vertex with the largest upper bound and the one with the
+/// smallest lower bound, preferring high degree on ties. On real-world graphs
+/// a few tens of searches usually determine every eccentricity.
+/// @tparam Id type of the vertices
+/// @param symmetric symmetric compressed sparse row, without self loops and
+/// parallel edges, as built by make_symmetric_csr
+/// @param max_sweeps maximum number of breadth first searches
+/// @return the bounds reached, which are equal for every vertex when the
+/// algorithm completes within max_sweeps searches
+template <concepts::Identifier Id>
+EccentricityBounds
+eccentricity_bounds(const CompressedSparseRow<Id> &symmetric,
+                    size_t max_sweeps = std::numeric_limits<size_t>::max());
+
+/// @brief Bounds on the eccentricities of a graph, ignoring the direction of
+/// the edges, self loops and parallel edges.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param max_sweeps maximum number of breadth first searches
+/// @return the bounds reached
+template <concepts::Graph G>
+EccentricityBounds
+eccentricity_bounds(const G &graph,
+                    size_t max_sweeps = std::numeric_limits<size_t>::max());
+
+/// @brief Exact eccentricities by the bounding eccentricities algorithm.
+/// @tparam Id type of the vertices
+/// @param symmetric symmetric compressed sparse row, without self loops and
+/// parallel edges, as built by make_symmetric_csr
+/// @return the eccentricity of every vertex within its connected component
+template <concepts::Identifier Id>
+std::vector<size_t> eccentricities(const CompressedSparseRow<Id> &symmetric);
+
+/// @brief Exact eccentricities of a graph, ignoring the direction of the
+/// edges, self loops and parallel edges.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @return the eccentricity of every vertex within its connected component
+template <concepts::Graph G>
+std::vector<size_t> eccentricities(const G &graph);
+
+/// @brief Implementation of the bounding diameter algorithm of Takes and
+/// Kosters. Eccentricities are bounded as in eccentricity_bounds, but a vertex
+/// is dropped as soon as its upper bound does not exceed the largest lower
+/// bound, which is a lower bound on the diameter, so the searches stop when
+/// no vertex can have a larger eccentricity.
+/// @tparam Id type of the vertices
+/// @param symmetric symmetric compressed sparse row, without self loops and
+/// parallel edges, as built by make_symmetric_csr
+/// @return the largest eccentricity, that is the largest diameter of the
+/// connected components
+template <concepts::Identifier Id>
+size_t diameter(const CompressedSparseRow<Id> &symmetric);
+
+/// @brief Diameter of a graph, ignoring the direction of the edges, self
+/// loops and parallel edges.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @return the largest diameter of the connected components
+template <concepts::Graph G> size_t diameter(const G &graph);
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/diameter.i.hpp"
@@ -0,0 +1,83 @@
+/**
+ * @file This file is the header of the Hopcroft-Karp algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"                 // Vertex
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // default_num_threads
+
+#include <concepts> // std::predicate
+#include <cstdint>  // size_t
+#include <vector>   // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Implementation of Hopcroft-Karp algorithm for the maximum matching
+/// of a bipartite graph, in O(E sqrt(V)). At every phase, a BFS from all the
+/// free vertices of the left side builds the layers of the shortest
+/// alternating paths, then an iterative DFS with current edge pointers finds
+/// a maximal set of vertex disjoint shortest augmenting paths and flips them.
+/// Only the out edges of the left vertices towards right vertices are used,
+/// so directed graphs must have their edges going from left to right.
+/// Optionally, the matching starts from a greedy one, built in parallel by
+/// letting every left vertex claim its first free neighbour atomically.
+/// @tparam G type of input graph
+/// @tparam Side predicate telling the side of a vertex
+/// @param graph graph on which the algorithm will run
+/// @param is_left true for the vertices of the left side
+/// @param greedy_initialization whether to start from a greedy matching
+/// @param num_threads maximum number of threads used by the initialization
+/// @return the mate of every vertex, INVALID_VERTEX for unmatched vertices
+template <concepts::Graph G, std::predicate<Vertex<G>> Side>
+std::vector<Vertex<G>>
+hopcroft_karp(const G &graph, Side is_left, bool greedy_initialization = true,
+              size_t num_threads = utils::default_num_threads());
+
+/// @brief Implementation of Hopcroft-Karp algorithm for the maximum matching
+/// of a bipartite graph, with the side of every vertex given as a vector.
+/// @tparam G type of input graph
+/// @param graph graph on which the algorithm will run
+/// @param is_left true for the vertices of the left side
+/// @param greedy_initialization whether to start from a greedy matching
+/// @param num_threads maximum number of threads used by the initialization
+/// @return the mate of every vertex, INVALID_VERTEX for unmatched vertices
+template <concepts::Graph G>
+std::vector<Vertex<G>>
+hopcroft_karp(const G &graph, const std::vector<bool> &is_left,
+              bool greedy_initialization = true,
+              size_t num_threads = utils::default_num_threads());
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/hopcroft_karp.i.hpp"
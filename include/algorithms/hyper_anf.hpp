@@ -0,0 +1,96 @@
+/**
+ * @file This file is the header of the HyperANF algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // default_num_threads
+
+#include <cstdint> // size_t
+#include <limits>  // std::numeric_limits
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Estimated neighbourhood function of a graph and distances of its
+/// vertices.
+struct NeighbourhoodFunction {
+  /// @brief Estimated number of pairs (x, y) with y reachable from x in at
+  /// most t steps, for every t until the estimates stop growing
+  std::vector<double> estimates;
+  /// @brief Estimated number of vertices reachable from every vertex,
+  /// including itself
+  std::vector<double> reachable;
+  /// @brief Estimated sum of the distances from every vertex to the vertices
+  /// reachable from it. The closeness of a vertex can be estimated as
+  /// (reachable - 1) / sum_of_distances
+  std::vector<double> sum_of_distances;
+};
+
+/// @brief Implementation of HyperANF. Every vertex keeps a HyperLogLog
+/// counter estimating the size of its ball, the set of vertices reachable in
+/// at most t steps, starting from the vertex alone. At every iteration the
+/// counter of a vertex becomes the union of its own and those of its out
+/// neighbours, that is the register-wise maximum, computed 32 registers at a
+/// time with AVX2 when available. Only the neighbours whose counter changed
+/// in the previous iteration are merged, and the vertices are processed in
+/// parallel with double buffered counters. The relative standard deviation
+/// of every estimate is about 1.04 / sqrt(2^log2_registers).
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param log2_registers logarithm of the number of registers per vertex,
+/// between 4 and 16
+/// @param max_iterations maximum number of iterations
+/// @param seed seed of the hash function of the counters
+/// @param num_threads maximum number of threads to use
+/// @throws InvariantViolationException if log2_registers is out of range
+/// @return the neighbourhood function and the per-vertex estimates
+template <concepts::Graph G>
+NeighbourhoodFunction
+hyper_anf(const G &graph, size_t log2_registers = 6,
+          size_t max_iterations = std::numeric_limits<size_t>::max(),
+          unsigned seed = 0,
+          size_t num_threads = utils::default_num_threads());
+
+/// @brief Effective diameter: the smallest number of steps, interpolated
+/// linearly between iterations, within which the given fraction of the
+/// reachable pairs is reached.
+/// @param estimates neighbourhood function, as computed by hyper_anf
+/// @param fraction fraction of the reachable pairs, in (0, 1]
+/// @return the effective diameter, zero for an empty neighbourhood function
+inline double effective_diameter(const std::vector<double> &estimates,
+                                 double fraction = 0.9);
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/hyper_anf.i.hpp"
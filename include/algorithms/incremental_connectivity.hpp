@@ -0,0 +1,105 @@
+/**
+ * @file This file is the header of the incremental connectivity structure
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"                 // Vertex, Edge
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // default_num_threads
+#include "utils/union_find.hpp"     // ConcurrentUnionFind
+
+#include <cstdint> // size_t
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Keeps the connected components of a graph up to date while edges
+/// are inserted, so that connectivity queries are answered in almost constant
+/// time without visiting the graph again. Edges must be inserted through this
+/// structure, which forwards them to the graph and unites the sets of their
+/// endpoints in a lock-free union-find. Directed graphs are treated as
+/// undirected, so their weakly connected components are kept. Removals, and
+/// changes made directly on the graph, are not tracked.
+/// @tparam G type of the graph
+template <concepts::Graph G> class IncrementalConnectivity {
+public:
+  using Vertex = graphxx::Vertex<G>;
+  using Edge = graphxx::Edge<G>;
+  using Attributes = typename G::Attributes;
+
+  /// @brief Builds the structure from the current components of a graph.
+  /// @param graph Graph to track, which must outlive the structure.
+  /// @param num_threads Maximum number of threads to use.
+  explicit IncrementalConnectivity(
+      G &graph, size_t num_threads = utils::default_num_threads());
+
+  /// @brief Adds an edge to the graph and merges the components of its
+  /// endpoints. Missing endpoints are added to the graph.
+  /// @param source Id of the source vertex.
+  /// @param target Id of the target vertex.
+  /// @param attributes Tuple containing edge attributes.
+  void add_edge(Vertex source, Vertex target, Attributes attributes = {});
+
+  /// @brief Adds a batch of edges to the graph, then merges the components of
+  /// their endpoints in parallel.
+  /// @param edges Edges to add, with their attributes.
+  /// @param num_threads Maximum number of threads to use.
+  void add_edges(const std::vector<Edge> &edges,
+                 size_t num_threads = utils::default_num_threads());
+
+  /// @brief Check if two vertices are in the same component.
+  /// @param lhs First vertex.
+  /// @param rhs Second vertex.
+  /// @return true if a path connects the vertices, false otherwise.
+  bool connected(Vertex lhs, Vertex rhs);
+
+  /// @brief Get the component of a vertex.
+  /// @param vertex Id of the vertex.
+  /// @return The smallest vertex of the component.
+  Vertex component(Vertex vertex);
+
+  /// @brief Get number of components, isolated vertices included.
+  [[nodiscard]] size_t num_components() const;
+
+private:
+  /// @brief Adds singleton sets for the vertices added to the graph.
+  void grow();
+
+  G &_graph;
+  utils::ConcurrentUnionFind<Vertex> _sets;
+  size_t _num_unions = 0;
+};
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/incremental_connectivity.i.hpp"
@@ -0,0 +1,95 @@
+/**
+ * @file This file is the header of the k-core decomposition algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "graph_concepts.hpp"                 // Graph, Identifier
+#include "utils/parallel_utils.hpp"           // default_num_threads
+
+#include <cstdint> // size_t
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Implementation of the Batagelj-Zaversnik algorithm for the core
+/// numbers of a simple undirected graph, in O(V + E). Vertices are kept in an
+/// array sorted by current degree, with the start of every degree bucket, so
+/// that removing the vertex of minimum degree and decrementing the degrees of
+/// its neighbours take constant time each.
+/// @tparam Id type of the vertices
+/// @param symmetric symmetric compressed sparse row, without self loops and
+/// parallel edges, as built by make_symmetric_csr
+/// @return the core number of every vertex, that is the largest k such that
+/// the vertex belongs to a subgraph with minimum degree k
+template <concepts::Identifier Id>
+std::vector<size_t> core_numbers(const CompressedSparseRow<Id> &symmetric);
+
+/// @brief Implementation of the Batagelj-Zaversnik algorithm for the core
+/// numbers of a graph, ignoring the direction of the edges, self loops and
+/// parallel edges.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @return the core number of every vertex
+template <concepts::Graph G> std::vector<size_t> core_numbers(const G &graph);
+
+/// @brief Parallel computation of the core numbers by peeling. At level k,
+/// the vertices of degree at most k are removed in rounds: every round
+/// removes a frontier concurrently, decrementing the degrees of the remaining
+/// neighbours atomically, and the neighbours whose degree drops to k form the
+/// next frontier. Levels without vertices are skipped by jumping to the
+/// minimum remaining degree.
+/// @tparam Id type of the vertices
+/// @param symmetric symmetric compressed sparse row, without self loops and
+/// parallel edges, as built by make_symmetric_csr
+/// @param num_threads maximum number of threads to use
+/// @return the core number of every vertex
+template <concepts::Identifier Id>
+std::vector<size_t>
+parallel_core_numbers(const CompressedSparseRow<Id> &symmetric,
+                      size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel computation of the core numbers of a graph by peeling,
+/// ignoring the direction of the edges, self loops and parallel edges.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param num_threads maximum number of threads to use
+/// @return the core number of every vertex
+template <concepts::Graph G>
+std::vector<size_t>
+parallel_core_numbers(const G &graph,
+                      size_t num_threads = utils::default_num_threads());
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/k_core.i.hpp"
@@ -0,0 +1,89 @@
+/**
+ * @file This file is the header of Yen's K shortest paths algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"           // Vertex, Edge
+#include "graph_concepts.hpp" // Graph, Identifier, Numeric
+
+#include <concepts>   // std::invocable
+#include <cstdint>    // size_t
+#include <functional> // std::function
+#include <tuple>      // std::tuple_element_t
+#include <utility>    // std::declval
+#include <vector>     // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Path between two vertices with its total weight.
+/// @tparam Id type of vertices identifier
+/// @tparam Distance type of the total weight
+template <concepts::Identifier Id, concepts::Numeric Distance>
+struct WeightedPath {
+  /// @brief Vertices of the path, from the source to the target
+  std::vector<Id> vertices;
+  /// @brief Sum of the weights of the edges of the path
+  Distance distance;
+};
+
+/// @brief Implementation of Yen's algorithm for the K shortest loopless
+/// paths. Every new path deviates from one already found at a spur vertex:
+/// the root up to the spur vertex is kept and a shortest spur path to the
+/// target is searched without the root vertices and without the edges leaving
+/// the spur vertex along the paths sharing the same root. The searches run on
+/// a flat copy of the graph and share one Dijkstra workspace, where visited
+/// vertices and removed vertices and edges are marked with epoch stamps, so
+/// starting a search and removing an element take constant time and the graph
+/// is never modified.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of distance among the nodes
+/// @param graph input graph
+/// @param source starting vertex
+/// @param target goal vertex
+/// @param k maximum number of paths
+/// @param weight weight function
+/// @throws InvariantViolationException if an edge weight is negative
+/// @return at most k distinct loopless paths from source to target, by non
+/// decreasing distance
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+std::vector<WeightedPath<Vertex<G>, Distance>> k_shortest_paths(
+    const G &graph, Vertex<G> source, Vertex<G> target, size_t k,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); });
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/k_shortest_paths.i.hpp"
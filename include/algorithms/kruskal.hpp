@@ -32,10 +32,12 @@
 
 #pragma once
 
-#include "base.hpp"           // Edge
-#include "graph_concepts.hpp" // Graph
+#include "base.hpp"                 // Edge
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // default_num_threads
 
 #include <concepts>   // std::invocable
+#include <cstdint>    // size_t
 #include <functional> // std::function
 #include <tuple>      // std::tuple_element_t
 #include <utility>    // std::declval
@@ -64,6 +66,32 @@ std::vector<Edge<G>> kruskal(
     const G &graph,
     Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); });
 
+/// @brief Implementation of the Filter-Kruskal algorithm. Instead of sorting
+/// all the edges, they are partitioned around a pivot weight: the lighter half
+/// is processed first, then the edges of the heavier half whose endpoints are
+/// already in the same tree are filtered out before processing the rest, so
+/// most of the heavy edges are never sorted. Sorting and filtering work on
+/// lightweight (weight, edge index) keys, use up to `num_threads` threads, and
+/// the search stops as soon as the tree spans every vertex. Each edge of an
+/// undirected graph is considered once and self loops are skipped. The weight
+/// function can be called concurrently by several threads. Edges are returned
+/// in increasing weight order, ties broken by adjacency order.
+/// @tparam G type of input graph
+/// @tparam Weight function used to get weight of an edge
+/// @tparam Distance type of distance among the nodes
+/// @param graph graph on which the algorithm will run
+/// @param weight weight function
+/// @param num_threads maximum number of threads to use
+/// @return a vector of edges
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Weight =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Distance = decltype(std::declval<Weight>()(Edge<G>{}))>
+std::vector<Edge<G>> filter_kruskal(
+    const G &graph,
+    Weight weight = [](const Edge<G> &edge) { return std::get<2>(edge); },
+    size_t num_threads = utils::default_num_threads());
+
 } // namespace graphxx::algorithms
 
 #include "algorithms/kruskal.i.hpp"
\ No newline at end of file
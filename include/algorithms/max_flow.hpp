@@ -0,0 +1,134 @@
+/**
+ * @file This file is the header of the maximum flow algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/residual_graph.hpp" // ResidualGraph
+#include "base.hpp"                    // Vertex, Edge
+#include "graph_concepts.hpp"          // Graph
+
+#include <concepts>    // std::invocable
+#include <functional>  // std::function
+#include <tuple>       // std::tuple_element_t
+#include <type_traits> // std::type_identity_t
+#include <utility>     // std::declval
+#include <vector>      // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Implementation of Dinic algorithm on a residual network. At every
+/// phase, a BFS from the source assigns a level to the vertices, then a
+/// blocking flow is sent along the shortest augmenting paths only, which go
+/// from a level to the next one. Paths are searched iteratively and every
+/// vertex remembers its current arc, so an arc that cannot carry more flow is
+/// never examined twice in the same phase. The flow is left in the network.
+/// @tparam Id type of vertices identifier
+/// @tparam Flow type of flow and capacity of the arcs
+/// @param network residual network on which the algorithm will run
+/// @param source starting vertex
+/// @param sink goal vertex
+/// @return the value of the maximum flow from source to sink
+template <concepts::Identifier Id, concepts::Numeric Flow>
+Flow dinic(ResidualGraph<Id, Flow> &network, std::type_identity_t<Id> source,
+           std::type_identity_t<Id> sink);
+
+/// @brief Implementation of Dinic algorithm on the residual network of a
+/// graph.
+/// @tparam G type of input graph
+/// @tparam Capacity function used to get the capacity of an edge
+/// @tparam Flow type of flow and capacity of the edges
+/// @param graph graph on which the algorithm will run
+/// @param source starting vertex
+/// @param sink goal vertex
+/// @param capacity capacity function
+/// @return the value of the maximum flow from source to sink
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Capacity =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Flow = decltype(std::declval<Capacity>()(Edge<G>{}))>
+Flow dinic(
+    const G &graph, Vertex<G> source, Vertex<G> sink,
+    Capacity capacity = [](const Edge<G> &edge) { return std::get<2>(edge); });
+
+/// @brief Implementation of the highest-label push-relabel algorithm on a
+/// residual network. Vertices with excess flow push it towards neighbours
+/// one level below, or raise their level when they cannot; the active vertex
+/// with the highest level is always discharged first. Two heuristics keep
+/// levels close to the exact distances: a global relabel recomputes them with
+/// a backward BFS from the sink after O(V + E) work, and when no vertex is
+/// left at some level below V, every vertex above it is lifted at once, since
+/// it cannot reach the sink anymore. Excess that cannot reach the sink goes
+/// back to the source, so a valid flow is left in the network.
+/// @tparam Id type of vertices identifier
+/// @tparam Flow type of flow and capacity of the arcs
+/// @param network residual network on which the algorithm will run
+/// @param source starting vertex
+/// @param sink goal vertex
+/// @return the value of the maximum flow from source to sink
+template <concepts::Identifier Id, concepts::Numeric Flow>
+Flow push_relabel(ResidualGraph<Id, Flow> &network,
+                  std::type_identity_t<Id> source,
+                  std::type_identity_t<Id> sink);
+
+/// @brief Implementation of the highest-label push-relabel algorithm on the
+/// residual network of a graph.
+/// @tparam G type of input graph
+/// @tparam Capacity function used to get the capacity of an edge
+/// @tparam Flow type of flow and capacity of the edges
+/// @param graph graph on which the algorithm will run
+/// @param source starting vertex
+/// @param sink goal vertex
+/// @param capacity capacity function
+/// @return the value of the maximum flow from source to sink
+template <concepts::Graph G,
+          std::invocable<Edge<G>> Capacity =
+              std::function<std::tuple_element_t<2, Edge<G>>(const Edge<G> &)>,
+          typename Flow = decltype(std::declval<Capacity>()(Edge<G>{}))>
+Flow push_relabel(
+    const G &graph, Vertex<G> source, Vertex<G> sink,
+    Capacity capacity = [](const Edge<G> &edge) { return std::get<2>(edge); });
+
+/// @brief Finds the source side of a minimum cut, once a maximum flow has been
+/// sent through the network.
+/// @tparam Id type of vertices identifier
+/// @tparam Flow type of flow and capacity of the arcs
+/// @param network residual network carrying a maximum flow
+/// @param source starting vertex
+/// @return for every vertex, true if it is still reachable from the source
+template <concepts::Identifier Id, concepts::Numeric Flow>
+std::vector<bool> min_cut(const ResidualGraph<Id, Flow> &network,
+                          std::type_identity_t<Id> source);
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/max_flow.i.hpp"
@@ -0,0 +1,119 @@
+/**
+ * @file This file is the header of the minimum cost flow algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/residual_graph.hpp" // ResidualGraph
+#include "base.hpp"                    // Vertex, Edge
+#include "graph_concepts.hpp"          // Graph
+
+#include <concepts>    // std::invocable
+#include <limits>      // std::numeric_limits
+#include <type_traits> // std::type_identity_t
+#include <utility>     // std::declval
+#include <vector>      // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Result of the minimum cost flow algorithm
+/// @tparam Flow type of flow and capacity of the edges
+/// @tparam Cost type of the costs
+template <concepts::Numeric Flow, concepts::Numeric Cost> struct MinCostFlow {
+  /// @brief Value of the flow sent from the source to the sink
+  Flow flow;
+  /// @brief Total cost of the flow
+  Cost cost;
+  /// @brief Flow on every edge, by position in the out edges enumeration of
+  /// the graph (vertex by vertex, in adjacency order). Empty when the
+  /// algorithm runs directly on a residual network, whose arcs already carry
+  /// the flow.
+  std::vector<Flow> edge_flow;
+};
+
+/// @brief Implementation of the successive shortest paths algorithm on a
+/// residual network. Flow is always sent along a cheapest augmenting path.
+/// Paths are found with Dijkstra on the reduced costs c(u, v) + p(u) - p(v),
+/// which stay non negative thanks to vertex potentials p updated after every
+/// search, as in Johnson algorithm; Bellman-Ford computes the initial
+/// potentials only when some arc has a negative cost. Dijkstra uses an
+/// indexed heap and stops as soon as the sink is settled.
+/// @tparam Id type of vertices identifier
+/// @tparam Flow type of flow and capacity of the arcs
+/// @tparam Cost type of the costs
+/// @param network residual network on which the algorithm will run, built by
+/// make_directed_residual_graph
+/// @param cost cost of sending a unit of flow along every arc, where the
+/// reverse of an arc has the opposite cost
+/// @param source starting vertex
+/// @param sink goal vertex
+/// @param flow_limit maximum value of the flow to send
+/// @return the value and the cost of the flow
+/// @throw InvariantViolationException if a cycle of negative cost with
+/// available capacity is found
+template <concepts::Identifier Id, concepts::Numeric Flow,
+          concepts::Numeric Cost>
+MinCostFlow<Flow, Cost>
+min_cost_flow(ResidualGraph<Id, Flow> &network, const std::vector<Cost> &cost,
+              std::type_identity_t<Id> source, std::type_identity_t<Id> sink,
+              Flow flow_limit = std::numeric_limits<Flow>::max());
+
+/// @brief Implementation of the successive shortest paths algorithm on a
+/// graph, sending the maximum flow, or at most flow_limit, from the source to
+/// the sink with the minimum total cost. Every stored edge is an independent
+/// arc, so an undirected edge can carry flow in both directions, each one up
+/// to its capacity.
+/// @tparam G type of input graph
+/// @tparam Capacity function used to get the capacity of an edge
+/// @tparam CostFunction function used to get the unit cost of an edge
+/// @tparam Flow type of flow and capacity of the edges
+/// @tparam Cost type of the costs
+/// @param graph graph on which the algorithm will run
+/// @param source starting vertex
+/// @param sink goal vertex
+/// @param capacity capacity function
+/// @param cost cost function
+/// @param flow_limit maximum value of the flow to send
+/// @return the value and the cost of the flow, and the flow on every edge
+/// @throw InvariantViolationException if a cycle of negative cost is found
+template <concepts::Graph G, std::invocable<Edge<G>> Capacity,
+          std::invocable<Edge<G>> CostFunction,
+          typename Flow = decltype(std::declval<Capacity>()(Edge<G>{})),
+          typename Cost = decltype(std::declval<CostFunction>()(Edge<G>{}))>
+MinCostFlow<Flow, Cost>
+min_cost_flow(const G &graph, Vertex<G> source, Vertex<G> sink,
+              Capacity capacity, CostFunction cost,
+              Flow flow_limit = std::numeric_limits<Flow>::max());
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/min_cost_flow.i.hpp"
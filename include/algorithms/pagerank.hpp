@@ -0,0 +1,127 @@
+/**
+ * @file This file is the header of the PageRank algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "graph_concepts.hpp"                 // Graph, Identifier
+#include "utils/parallel_utils.hpp"           // default_num_threads
+
+#include <concepts> // std::floating_point
+#include <cstdint>  // size_t
+#include <vector>   // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Parallel PageRank by power iteration, pulling the rank of every
+/// vertex from its in edges so that every thread writes only the vertices of
+/// its own range and no atomics are needed. The rank of the dangling vertices
+/// is spread over all the vertices at every iteration. The iteration stops
+/// when the L1 distance between two consecutive rank vectors falls below the
+/// tolerance, or after the given number of iterations.
+/// @tparam Rank floating point type of the ranks
+/// @tparam Id type of the vertices
+/// @param in_edges compressed sparse row of the in edges, as built by
+/// make_transposed_csr
+/// @param damping probability of following an edge instead of teleporting
+/// @param tolerance L1 distance under which the ranks are considered stable
+/// @param max_iterations maximum number of iterations
+/// @param num_threads maximum number of threads to use
+/// @return the rank of every vertex, summing up to one
+template <std::floating_point Rank = double, concepts::Identifier Id>
+std::vector<Rank>
+pagerank(const CompressedSparseRow<Id> &in_edges, Rank damping = 0.85,
+         Rank tolerance = 1e-6, size_t max_iterations = 100,
+         size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel PageRank of a graph, computed on its in edges transposed
+/// once in a compressed sparse row.
+/// @tparam Rank floating point type of the ranks
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param damping probability of following an edge instead of teleporting
+/// @param tolerance L1 distance under which the ranks are considered stable
+/// @param max_iterations maximum number of iterations
+/// @param num_threads maximum number of threads to use
+/// @return the rank of every vertex, summing up to one
+template <std::floating_point Rank = double, concepts::Graph G>
+std::vector<Rank> pagerank(const G &graph, Rank damping = 0.85,
+                           Rank tolerance = 1e-6, size_t max_iterations = 100,
+                           size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel personalized PageRank, where every teleport, and the rank
+/// of the dangling vertices, goes to the vertices in proportion to the given
+/// weights instead of uniformly.
+/// @tparam Rank floating point type of the ranks
+/// @tparam Id type of the vertices
+/// @param in_edges compressed sparse row of the in edges, as built by
+/// make_transposed_csr
+/// @param personalization non negative teleport weight of every vertex, not
+/// necessarily normalized
+/// @param damping probability of following an edge instead of teleporting
+/// @param tolerance L1 distance under which the ranks are considered stable
+/// @param max_iterations maximum number of iterations
+/// @param num_threads maximum number of threads to use
+/// @throws InvariantViolationException if the weights are negative, sum up to
+/// zero or are not one per vertex
+/// @return the rank of every vertex, summing up to one
+template <std::floating_point Rank, concepts::Identifier Id>
+std::vector<Rank> personalized_pagerank(
+    const CompressedSparseRow<Id> &in_edges,
+    const std::vector<Rank> &personalization, Rank damping = 0.85,
+    Rank tolerance = 1e-6, size_t max_iterations = 100,
+    size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel personalized PageRank of a graph, computed on its in edges
+/// transposed once in a compressed sparse row.
+/// @tparam Rank floating point type of the ranks
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param personalization non negative teleport weight of every vertex, not
+/// necessarily normalized
+/// @param damping probability of following an edge instead of teleporting
+/// @param tolerance L1 distance under which the ranks are considered stable
+/// @param max_iterations maximum number of iterations
+/// @param num_threads maximum number of threads to use
+/// @throws InvariantViolationException if the weights are negative, sum up to
+/// zero or are not one per vertex
+/// @return the rank of every vertex, summing up to one
+template <std::floating_point Rank, concepts::Graph G>
+std::vector<Rank> personalized_pagerank(
+    const G &graph, const std::vector<Rank> &personalization,
+    Rank damping = 0.85, Rank tolerance = 1e-6, size_t max_iterations = 100,
+    size_t num_threads = utils::default_num_threads());
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/pagerank.i.hpp"
@@ -0,0 +1,110 @@
+/**
+ * @file This file is the header of the parallel strongly connected components algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "algorithms/tarjan.hpp"              // SCCVector
+#include "base.hpp"                           // Vertex
+#include "graph_concepts.hpp"                 // Graph
+#include "utils/parallel_utils.hpp"           // default_num_threads
+
+#include <cstdint> // size_t
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Flat description of the strongly connected components of a graph.
+/// @tparam Id type of vertices identifier
+template <concepts::Identifier Id> struct SCCComponents {
+  /// @brief Id of the component of every vertex
+  std::vector<Id> component;
+  /// @brief Number of vertices in every component
+  std::vector<size_t> sizes;
+};
+
+/// @brief Parallel computation of the strongly connected components, following
+/// the Multistep scheme. First, vertices without in or out edges are trimmed
+/// repeatedly, since each of them is a component by itself. Then a single
+/// Forward-Backward step from the vertex with the highest degree extracts the
+/// giant component as the intersection of its forward and backward reachable
+/// sets. The remaining vertices are resolved by coloring: the largest vertex id
+/// that reaches each vertex is propagated forward, and every vertex whose
+/// color is its own id is the root of the component made of the vertices of
+/// its color that reach it backward. Components are numbered in increasing
+/// order of their smallest vertex.
+/// @tparam G type of input graph
+/// @param graph graph on which the algorithm will run
+/// @param num_threads maximum number of threads to use
+/// @return the component of every vertex and the size of every component
+template <concepts::Graph G>
+SCCComponents<Vertex<G>>
+parallel_scc(const G &graph,
+             size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel computation of the strongly connected components of a
+/// graph given as compressed sparse rows of its out and in edges.
+/// @tparam Id type of vertices identifier
+/// @param out_edges compressed sparse row of the out edges
+/// @param in_edges compressed sparse row of the in edges
+/// @param num_threads maximum number of threads to use
+/// @return the component of every vertex and the size of every component
+template <concepts::Identifier Id>
+SCCComponents<Id>
+parallel_scc(const CompressedSparseRow<Id> &out_edges,
+             const CompressedSparseRow<Id> &in_edges,
+             size_t num_threads = utils::default_num_threads());
+
+/// @brief Converts the flat description of the strongly connected components
+/// into a vector of components, each one listing its vertices in increasing
+/// order, as the components returned by tarjan.
+/// @tparam Id type of vertices identifier
+/// @param components flat description of the components
+/// @return a vector containing all the strongly connected components
+template <concepts::Identifier Id>
+SCCVector<Id> to_scc_vector(const SCCComponents<Id> &components);
+
+/// @brief Converts a vector of components, as the one returned by tarjan, into
+/// the flat description of the components. Components keep their position in
+/// the vector as id.
+/// @tparam Id type of vertices identifier
+/// @param scc_vector vector containing all the strongly connected components
+/// @param num_vertices number of vertices of the graph
+/// @return the component of every vertex and the size of every component
+template <concepts::Identifier Id>
+SCCComponents<Id> to_scc_components(const SCCVector<Id> &scc_vector,
+                                    size_t num_vertices);
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/parallel_scc.i.hpp"
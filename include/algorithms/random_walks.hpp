@@ -0,0 +1,186 @@
+/**
+ * @file This file is the header of the random walks generator
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "base.hpp"                           // Vertex, Edge
+#include "graph_concepts.hpp"                 // Graph, Identifier
+#include "utils/parallel_utils.hpp"           // default_num_threads
+#include "utils/random_utils.hpp"             // CounterRng
+
+#include <concepts> // std::invocable
+#include <cstdint>  // size_t
+#include <span>     // std::span
+#include <vector>   // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Random walks stored one after the other in a flat buffer.
+/// @tparam Id type of vertices identifier
+template <concepts::Identifier Id> struct RandomWalks {
+  /// @brief Vertices of all the walks
+  std::vector<Id> vertices;
+  /// @brief Walk i is vertices[offsets[i]] up to vertices[offsets[i + 1]]
+  std::vector<size_t> offsets;
+};
+
+/// @brief Generator of random walks over the out edges of a graph, uniform or
+/// weighted, and of node2vec second order walks. The transitions are built
+/// once: the out neighbours of every vertex are sorted, and for weighted walks
+/// every vertex gets an alias table, so that each step takes constant time.
+/// Every vertex starts walks_per_vertex walks, walk i starting from vertex
+/// i % V, and walk i draws its numbers from the counter-based stream i, so the
+/// walks do not depend on the number of threads. A walk stops early at a
+/// vertex without out edges.
+/// @tparam G type of the graph
+template <concepts::Graph G> class RandomWalker {
+public:
+  using Vertex = graphxx::Vertex<G>;
+  using Edge = graphxx::Edge<G>;
+
+  /// @brief Builds the transitions of uniform walks.
+  /// @param graph Input graph, which is not referenced after construction.
+  /// @param num_threads Maximum number of threads to use.
+  explicit RandomWalker(const G &graph,
+                        size_t num_threads = utils::default_num_threads());
+
+  /// @brief Builds the transitions of walks choosing every out edge with
+  /// probability proportional to its weight. Edges of weight zero are never
+  /// taken.
+  /// @tparam Weight function used to get weight of an edge
+  /// @param graph Input graph, which is not referenced after construction.
+  /// @param weight Weight function.
+  /// @param num_threads Maximum number of threads to use.
+  /// @throws InvariantViolationException if an edge weight is negative
+  template <std::invocable<Edge> Weight>
+  RandomWalker(const G &graph, Weight &&weight,
+               size_t num_threads = utils::default_num_threads());
+
+  /// @brief Generates first order walks in parallel.
+  /// @param walk_length Number of vertices of every walk, start included.
+  /// @param walks_per_vertex Number of walks starting from every vertex.
+  /// @param seed Seed of the random streams.
+  /// @param num_threads Maximum number of threads to use.
+  /// @return The walks, in order of index.
+  RandomWalks<Vertex>
+  walks(size_t walk_length, size_t walks_per_vertex, uint64_t seed = 0,
+        size_t num_threads = utils::default_num_threads()) const;
+
+  /// @brief Generates first order walks in parallel, passing every walk to a
+  /// sink instead of storing them all.
+  /// @tparam Sink function called with the index of a walk and its vertices
+  /// @param walk_length Number of vertices of every walk, start included.
+  /// @param walks_per_vertex Number of walks starting from every vertex.
+  /// @param sink Sink of the walks, called concurrently by the threads with
+  /// views valid only during the call.
+  /// @param seed Seed of the random streams.
+  /// @param num_threads Maximum number of threads to use.
+  template <std::invocable<size_t, std::span<const Vertex>> Sink>
+  void walks(size_t walk_length, size_t walks_per_vertex, Sink &&sink,
+             uint64_t seed = 0,
+             size_t num_threads = utils::default_num_threads()) const;
+
+  /// @brief Generates node2vec walks in parallel. After stepping from t to
+  /// v, the walk moves to a neighbour x of v with probability proportional to
+  /// the transition weight of (v, x) times 1 / p if x is t, 1 if x is an out
+  /// neighbour of t and 1 / q otherwise. Steps are drawn by rejection: a
+  /// first order transition is proposed and accepted with probability equal
+  /// to its bias over the largest bias, testing adjacency to t by binary
+  /// search among the sorted out neighbours of t, so no table per edge pair
+  /// is needed.
+  /// @param walk_length Number of vertices of every walk, start included.
+  /// @param walks_per_vertex Number of walks starting from every vertex.
+  /// @param p Return parameter, greater than zero.
+  /// @param q In-out parameter, greater than zero.
+  /// @param seed Seed of the random streams.
+  /// @param num_threads Maximum number of threads to use.
+  /// @throws InvariantViolationException if p or q is not positive
+  /// @return The walks, in order of index.
+  RandomWalks<Vertex>
+  node2vec_walks(size_t walk_length, size_t walks_per_vertex, double p,
+                 double q, uint64_t seed = 0,
+                 size_t num_threads = utils::default_num_threads()) const;
+
+  /// @brief Generates node2vec walks in parallel, passing every walk to a
+  /// sink instead of storing them all.
+  /// @tparam Sink function called with the index of a walk and its vertices
+  /// @param walk_length Number of vertices of every walk, start included.
+  /// @param walks_per_vertex Number of walks starting from every vertex.
+  /// @param p Return parameter, greater than zero.
+  /// @param q In-out parameter, greater than zero.
+  /// @param sink Sink of the walks, called concurrently by the threads with
+  /// views valid only during the call.
+  /// @param seed Seed of the random streams.
+  /// @param num_threads Maximum number of threads to use.
+  /// @throws InvariantViolationException if p or q is not positive
+  template <std::invocable<size_t, std::span<const Vertex>> Sink>
+  void node2vec_walks(size_t walk_length, size_t walks_per_vertex, double p,
+                      double q, Sink &&sink, uint64_t seed = 0,
+                      size_t num_threads = utils::default_num_threads()) const;
+
+private:
+  /// @brief Draws the next vertex of a walk from a vertex with out edges.
+  Vertex step(Vertex vertex, utils::CounterRng &rng) const;
+
+  /// @brief Writes the walks with indices in [first, last), at most BATCH,
+  /// advancing them together so that their cache misses overlap. Walk
+  /// first + i goes to out + i * walk_length and its length to lengths[i].
+  void walk_batch(size_t first, size_t last, size_t walk_length, double p,
+                  double q, uint64_t seed, Vertex *out,
+                  size_t *lengths) const;
+
+  /// @brief Generates the walks and collects them in a flat buffer.
+  RandomWalks<Vertex> collect(size_t walk_length, size_t walks_per_vertex,
+                              double p, double q, uint64_t seed,
+                              size_t num_threads) const;
+
+  /// @brief Generates the walks and passes them to a sink.
+  template <typename Sink>
+  void generate(size_t walk_length, size_t walks_per_vertex, double p,
+                double q, Sink &sink, uint64_t seed,
+                size_t num_threads) const;
+
+  /// @brief Out neighbours of every vertex, sorted.
+  CompressedSparseRow<Vertex> _adjacency;
+  /// @brief Probability of keeping every entry in its alias table, empty
+  /// for uniform walks.
+  std::vector<double> _probability;
+  /// @brief Alias of every entry, as a position among the neighbours of its
+  /// vertex, empty for uniform walks.
+  std::vector<size_t> _alias;
+};
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/random_walks.i.hpp"
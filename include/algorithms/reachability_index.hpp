@@ -0,0 +1,106 @@
+/**
+ * @file This file is the header of the reachability index
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "base.hpp"                           // Vertex
+#include "graph_concepts.hpp"                 // Graph
+#include "utils/parallel_utils.hpp"           // default_num_threads
+
+#include <cstdint> // size_t, uint64_t
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief GRAIL reachability index of a directed graph, for graphs too large
+/// for a transitive closure. The strongly connected components are found with
+/// parallel_scc and condensed, and every component gets an interval from each
+/// of a few randomized depth first visits of the condensation: its post order
+/// rank and the lowest rank among its descendants. When u reaches v every
+/// interval of v lies inside the matching interval of u, so most negative
+/// queries are answered by comparing the intervals. The other queries run a
+/// depth first visit from u that skips the components whose intervals do not
+/// contain those of v. Building takes O(k (V + E)) time and the index takes
+/// O(k V) memory, with k the number of intervals.
+/// @tparam G type of the graph
+template <concepts::Graph G> class ReachabilityIndex {
+public:
+  using Vertex = graphxx::Vertex<G>;
+
+  /// @brief Builds the index, one randomized visit per thread at a time.
+  /// @param graph Input graph, which is not referenced after construction.
+  /// @param num_labels Number of intervals of every component.
+  /// @param seed Seed of the random visit orders.
+  /// @param num_threads Maximum number of threads to use.
+  explicit ReachabilityIndex(const G &graph, size_t num_labels = 5,
+                             uint64_t seed = 0,
+                             size_t num_threads = utils::default_num_threads());
+
+  /// @brief Checks whether there is a path between two vertices. Every vertex
+  /// reaches itself. Queries can run concurrently: the visits use buffers
+  /// owned by the calling thread, reused from query to query.
+  /// @param source First vertex of the path.
+  /// @param target Last vertex of the path.
+  /// @return true if target is reachable from source.
+  bool reachable(Vertex source, Vertex target) const;
+
+  /// @brief Get the strongly connected component of every vertex.
+  const std::vector<Vertex> &component() const { return _component; }
+
+  /// @brief Get the number of strongly connected components.
+  size_t num_components() const { return _condensation.num_vertices(); }
+
+private:
+  /// @brief Checks whether every interval of inner lies inside the matching
+  /// interval of outer.
+  bool contains(Vertex outer, Vertex inner) const;
+
+  /// @brief Computes the intervals of one randomized depth first visit,
+  /// starting from the given roots in random order.
+  void label(size_t index, std::vector<Vertex> roots, uint64_t seed);
+
+  /// @brief Strongly connected component of every vertex.
+  std::vector<Vertex> _component;
+  /// @brief Condensation of the graph, a directed acyclic graph.
+  CompressedSparseRow<Vertex> _condensation;
+  /// @brief Number of intervals of every component.
+  size_t _num_labels;
+  /// @brief Intervals of every component, one after the other, each one as
+  /// its lowest and its highest rank.
+  std::vector<Vertex> _labels;
+};
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/reachability_index.i.hpp"
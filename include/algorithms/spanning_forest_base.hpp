@@ -0,0 +1,126 @@
+/**
+ * @file This file contains the helpers shared by the spanning forest algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"                 // Vertex, Edge
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // parallel_for
+
+#include <algorithm> // std::sort, std::upper_bound
+#include <cstdint>   // size_t
+#include <utility>   // std::pair
+#include <vector>    // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+namespace detail::spanning_forest {
+/// @brief Check if an edge is taken into account by the spanning forest
+/// algorithms, which treat edges as undirected: self loops never join two
+/// trees, and undirected edges are stored in both directions, so only the
+/// copy going towards the larger vertex is kept
+/// @tparam G type of the graph
+template <concepts::Graph G>
+bool is_spanning_candidate(const G &graph, const Edge<G> &edge) {
+  Vertex<G> source = graph.get_source(edge);
+  Vertex<G> target = graph.get_target(edge);
+  if constexpr (G::DIRECTEDNESS == Directedness::UNDIRECTED) {
+    return source < target;
+  } else {
+    return source != target;
+  }
+}
+
+/// @brief Numbers the candidate edges of a spanning forest vertex by vertex,
+/// in adjacency order, so that they can be stored in flat vectors filled
+/// concurrently
+/// @tparam G type of the graph
+/// @return the index of the first candidate edge of every vertex, followed by
+/// the number of candidate edges
+template <concepts::Graph G>
+std::vector<size_t> number_spanning_candidates(const G &graph,
+                                               size_t num_threads) {
+  size_t size = graph.num_vertices();
+  std::vector<size_t> offsets(size + 1, 0);
+  utils::parallel_for(
+      size_t{0}, size,
+      [&](size_t vertex) {
+        for (auto &&edge : graph[vertex]) {
+          offsets[vertex + 1] += is_spanning_candidate(graph, edge);
+        }
+      },
+      num_threads, size_t{256});
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    offsets[vertex + 1] += offsets[vertex];
+  }
+  return offsets;
+}
+
+/// @brief Retrieves the candidate edges with the given indices, visiting only
+/// the adjacency lists of the vertices owning at least one of them
+/// @tparam G type of the graph
+/// @return the edges, in the same order as the indices
+template <concepts::Graph G>
+std::vector<Edge<G>> spanning_edges(const G &graph,
+                                    const std::vector<size_t> &offsets,
+                                    const std::vector<size_t> &indices) {
+  std::vector<std::pair<size_t, size_t>> positions(indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    positions[i] = {indices[i], i};
+  }
+  std::sort(positions.begin(), positions.end());
+
+  std::vector<Edge<G>> edges(indices.size());
+  auto position = positions.begin();
+  while (position != positions.end()) {
+    auto vertex = static_cast<Vertex<G>>(
+        std::upper_bound(offsets.begin(), offsets.end(), position->first) -
+        offsets.begin() - 1);
+    size_t index = offsets[vertex];
+    for (auto &&edge : graph[vertex]) {
+      if (!is_spanning_candidate(graph, edge)) {
+        continue;
+      }
+      if (position != positions.end() && index == position->first) {
+        edges[position->second] = edge;
+        ++position;
+      }
+      ++index;
+    }
+  }
+
+  return edges;
+}
+} // namespace detail::spanning_forest
+
+} // namespace graphxx::algorithms
@@ -40,15 +40,23 @@
 /// algorithms namespace contains all the algorithms available and related support structures
 namespace graphxx::algorithms {
 
-/// @brief Stucture of the node, containing informations about
-struct TarjanNode {
-  int32_t index;
-  int32_t low_link;
+/// @brief Stucture of the node, containing informations about the order in
+/// which the vertex has been visited, the lowest index reachable from it and
+/// whether it is still on the stack of the current component
+/// @tparam Id type of vertices identifier
+template <concepts::Identifier Id> struct TarjanNode {
+  /// @brief Order in which the vertex has been discovered
+  Id index;
+  /// @brief Lowest index reachable from the vertex
+  Id low_link;
+  /// @brief True if the vertex is on the stack of the current component
   bool on_stack;
 };
 
 /// @brief a map of id to Node
-using TarjanTree = std::vector<TarjanNode>;
+/// @tparam Id type of vertices identifier
+template <concepts::Identifier Id>
+using TarjanTree = std::vector<TarjanNode<Id>>;
 
 /// @brief a vector of id
 /// @tparam Id type of vertices identifier
@@ -62,7 +70,8 @@ using SCCVector = std::vector<StackVector<Id>>;
 /// @brief Implementation of Tarjan algorithm. Tarjan starts by performing a DFS
 /// from an arbitrary start node. Then, the algorithms will
 /// recover all the strongly connected components as certain subtrees fromt he
-/// result of the DFS.
+/// result of the DFS. The visit is iterative, so it does not overflow the
+/// call stack on deep graphs.
 /// @tparam G type of input graph
 /// @param graph graph on which the algorithm will run
 /// @return a vector of vertices, containing all the strongly connected
@@ -0,0 +1,83 @@
+/**
+ * @file This file is the header of the topological sort algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "base.hpp"                 // Vertex
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // default_num_threads
+
+#include <cstdint> // size_t
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Vertices of a directed acyclic graph grouped by level, where the
+/// level of a vertex is the length of the longest path ending in it.
+/// @tparam Id type of vertices identifier
+template <concepts::Identifier Id> struct TopologicalLevels {
+  /// @brief Vertices by increasing level, which is a topological order
+  std::vector<Id> order;
+  /// @brief The vertices of level i are order[offsets[i]] up to
+  /// order[offsets[i + 1]]
+  std::vector<size_t> offsets;
+};
+
+/// @brief Implementation of Kahn algorithm for the topological sort of a
+/// directed acyclic graph, in O(V + E). Vertices without in edges are output
+/// first, and every vertex is output when all its in edges come from output
+/// vertices.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @throws InvariantViolationException if the graph has a cycle
+/// @return the vertices in topological order
+template <concepts::Graph G>
+std::vector<Vertex<G>> topological_sort(const G &graph);
+
+/// @brief Parallel variant of Kahn algorithm, which removes a whole frontier
+/// of vertices without in edges at a time. The in degrees of the targets are
+/// decremented atomically, and the vertices losing their last in edge form
+/// the next frontier, so that every frontier is a level of the graph.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param num_threads maximum number of threads to use
+/// @throws InvariantViolationException if the graph has a cycle
+/// @return the vertices grouped by level
+template <concepts::Graph G>
+TopologicalLevels<Vertex<G>>
+topological_levels(const G &graph,
+                   size_t num_threads = utils::default_num_threads());
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/topological_sort.i.hpp"
@@ -0,0 +1,106 @@
+/**
+ * @file This file is the header of the transitive closure algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "algorithms/parallel_scc.hpp" // SCCComponents
+#include "base.hpp"                    // Vertex
+#include "graph_concepts.hpp"          // Graph, Identifier
+#include "utils/parallel_utils.hpp"    // default_num_threads
+
+#include <cstdint> // size_t, uint64_t
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Reachability between the vertices of a directed graph, stored as a
+/// bitset over the strongly connected components for every component. Every
+/// vertex reaches itself.
+/// @tparam Id type of vertices identifier
+template <concepts::Identifier Id> struct TransitiveClosure {
+  /// @brief Strongly connected component of every vertex
+  std::vector<Id> component;
+  /// @brief Number of strongly connected components
+  size_t num_components;
+  /// @brief Number of 64 bit words of the bitset of every component
+  size_t words_per_row;
+  /// @brief Bitsets of the components, one after the other: bit j of the
+  /// bitset of component i is set when i reaches j
+  std::vector<uint64_t> bits;
+
+  /// @brief Checks whether there is a path between two vertices, in O(1)
+  /// @param source first vertex of the path
+  /// @param target last vertex of the path
+  /// @return true if target is reachable from source
+  bool reachable(Id source, Id target) const {
+    size_t row = component[source];
+    size_t column = component[target];
+    return (bits[row * words_per_row + column / 64] >> (column % 64)) & 1;
+  }
+};
+
+/// @brief Bitset transitive closure, in O(V + E + C (C + D) / 64) time and
+/// O(C^2) bits of memory, where C is the number of strongly connected
+/// components and D the number of edges between them.
+/// The components are found with parallel_scc and condensed; then the bitset
+/// of every component is its own bit or-ed with the bitsets of its
+/// successors, a word block at a time with AVX2 when available. Components
+/// are processed by increasing height, the length of the longest path to a
+/// sink, so components of the same height run in parallel. Successors are
+/// merged by decreasing height and skipped when already reached, since
+/// their bitset is then included in the one being built.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param num_threads maximum number of threads to use
+/// @return the components and their reachability bitsets
+template <concepts::Graph G>
+TransitiveClosure<Vertex<G>>
+transitive_closure(const G &graph,
+                   size_t num_threads = utils::default_num_threads());
+
+/// @brief Bitset transitive closure of a graph whose strongly connected
+/// components are already known, as returned by parallel_scc or
+/// to_scc_components.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param components strongly connected components of the graph
+/// @param num_threads maximum number of threads to use
+/// @return the components and their reachability bitsets
+template <concepts::Graph G>
+TransitiveClosure<Vertex<G>>
+transitive_closure(const G &graph, const SCCComponents<Vertex<G>> &components,
+                   size_t num_threads = utils::default_num_threads());
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/transitive_closure.i.hpp"
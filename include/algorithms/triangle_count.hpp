@@ -0,0 +1,120 @@
+/**
+ * @file This file is the header of the triangle counting algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "graph_concepts.hpp"                 // Graph, Identifier
+#include "utils/parallel_utils.hpp"           // default_num_threads
+
+#include <cstdint> // size_t
+#include <vector>  // std::vector
+
+/// algorithms namespace contains all the algorithms available and related support structures
+namespace graphxx::algorithms {
+
+/// @brief Parallel count of the triangles of a simple undirected graph. Every
+/// edge is oriented from the endpoint of smaller degree to the other one,
+/// breaking ties by id, so that every vertex keeps O(sqrt(E)) out neighbours
+/// and every triangle is found exactly once, by intersecting the out
+/// neighbours of the endpoints of its first edge. Intersections use the
+/// kernels of simd_utils.hpp.
+/// @tparam Id type of the vertices
+/// @param symmetric symmetric compressed sparse row with sorted neighbours,
+/// without self loops and parallel edges, as built by make_symmetric_csr
+/// @param num_threads maximum number of threads to use
+/// @return the number of triangles
+template <concepts::Identifier Id>
+size_t triangle_count(const CompressedSparseRow<Id> &symmetric,
+                      size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel count of the triangles of a graph, ignoring the direction
+/// of the edges, self loops and parallel edges.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param num_threads maximum number of threads to use
+/// @return the number of triangles
+template <concepts::Graph G>
+size_t triangle_count(const G &graph,
+                      size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel count of the triangles every vertex belongs to, with the
+/// same orientation used by triangle_count.
+/// @tparam Id type of the vertices
+/// @param symmetric symmetric compressed sparse row with sorted neighbours,
+/// without self loops and parallel edges, as built by make_symmetric_csr
+/// @param num_threads maximum number of threads to use
+/// @return the number of triangles of every vertex
+template <concepts::Identifier Id>
+std::vector<size_t>
+vertex_triangle_counts(const CompressedSparseRow<Id> &symmetric,
+                       size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel count of the triangles every vertex of a graph belongs to,
+/// ignoring the direction of the edges, self loops and parallel edges.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param num_threads maximum number of threads to use
+/// @return the number of triangles of every vertex
+template <concepts::Graph G>
+std::vector<size_t>
+vertex_triangle_counts(const G &graph,
+                       size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel computation of the local clustering coefficients, that is
+/// the fraction of pairs of neighbours of every vertex which are adjacent.
+/// @tparam Id type of the vertices
+/// @param symmetric symmetric compressed sparse row with sorted neighbours,
+/// without self loops and parallel edges, as built by make_symmetric_csr
+/// @param num_threads maximum number of threads to use
+/// @return the clustering coefficient of every vertex, zero for the vertices
+/// with less than two neighbours
+template <concepts::Identifier Id>
+std::vector<double>
+clustering_coefficients(const CompressedSparseRow<Id> &symmetric,
+                        size_t num_threads = utils::default_num_threads());
+
+/// @brief Parallel computation of the local clustering coefficients of a
+/// graph, ignoring the direction of the edges, self loops and parallel edges.
+/// @tparam G type of input graph
+/// @param graph input graph
+/// @param num_threads maximum number of threads to use
+/// @return the clustering coefficient of every vertex, zero for the vertices
+/// with less than two neighbours
+template <concepts::Graph G>
+std::vector<double>
+clustering_coefficients(const G &graph,
+                        size_t num_threads = utils::default_num_threads());
+
+} // namespace graphxx::algorithms
+
+#include "algorithms/triangle_count.i.hpp"
@@ -0,0 +1,206 @@
+/**
+ * @file This file contains the indexed priority queue
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include <algorithm>  // std::min
+#include <cstdint>    // size_t
+#include <functional> // std::less
+#include <limits>     // std::numeric_limits
+#include <vector>     // std::vector
+
+/// utils namespace contains all the utilities functions used throughout the project
+namespace graphxx::utils {
+
+/// @brief Addressable d-ary min-heap over the keys [0, capacity). Every key is
+///        stored at most once and its position is tracked, so its priority
+///        can be decreased in place instead of pushing a duplicate, and the
+///        heap never holds more than `capacity` entries. The default arity of
+///        4 keeps the children of a node in the same cache line for small
+///        priorities.
+/// @tparam Priority type of the priorities
+/// @tparam Compare strict ordering of the priorities, the smallest is on top
+/// @tparam Arity number of children of every node
+template <typename Priority, typename Compare = std::less<Priority>,
+          size_t Arity = 4>
+class IndexedHeap {
+public:
+  static_assert(Arity >= 2, "the heap needs at least two children per node");
+
+  IndexedHeap() = default;
+
+  /// @brief Builds an empty heap for the keys [0, capacity).
+  /// @param capacity Number of keys.
+  /// @param compare Ordering of the priorities.
+  explicit IndexedHeap(size_t capacity, Compare compare = {})
+      : _positions(capacity, NOT_IN_HEAP), _priorities(capacity),
+        _compare{compare} {}
+
+  /// @brief Check if the heap is empty.
+  [[nodiscard]] bool empty() const { return _heap.empty(); }
+
+  /// @brief Get the number of keys in the heap.
+  [[nodiscard]] size_t size() const { return _heap.size(); }
+
+  /// @brief Check if a key is in the heap.
+  /// @param key Key to look for.
+  [[nodiscard]] bool contains(size_t key) const {
+    return _positions[key] != NOT_IN_HEAP;
+  }
+
+  /// @brief Get the priority of a key, which is meaningful only if the key is
+  /// in the heap or was popped from it.
+  /// @param key Key to look for.
+  const Priority &priority(size_t key) const { return _priorities[key]; }
+
+  /// @brief Get the key with the smallest priority.
+  [[nodiscard]] size_t top() const { return _heap.front(); }
+
+  /// @brief Get the smallest priority.
+  const Priority &top_priority() const { return _priorities[_heap.front()]; }
+
+  /// @brief Inserts a key that is not in the heap.
+  /// @param key Key to insert.
+  /// @param priority Priority of the key.
+  void push(size_t key, const Priority &priority) {
+    _priorities[key] = priority;
+    _positions[key] = _heap.size();
+    _heap.push_back(key);
+    sift_up(_heap.size() - 1);
+  }
+
+  /// @brief Inserts a key, or lowers its priority if it is already in the
+  /// heap with a larger one.
+  /// @param key Key to insert or update.
+  /// @param priority New priority of the key.
+  /// @return true if the heap has changed, false otherwise.
+  bool push_or_decrease(size_t key, const Priority &priority) {
+    if (!contains(key)) {
+      push(key, priority);
+      return true;
+    }
+    if (!_compare(priority, _priorities[key])) {
+      return false;
+    }
+    _priorities[key] = priority;
+    sift_up(_positions[key]);
+    return true;
+  }
+
+  /// @brief Removes the key with the smallest priority.
+  /// @return The removed key.
+  size_t pop() {
+    size_t key = _heap.front();
+    _positions[key] = NOT_IN_HEAP;
+    if (_heap.size() > 1) {
+      _heap.front() = _heap.back();
+      _positions[_heap.front()] = 0;
+      _heap.pop_back();
+      sift_down(0);
+    } else {
+      _heap.pop_back();
+    }
+    return key;
+  }
+
+  /// @brief Removes all the keys, in time proportional to their number, so
+  /// the heap can be reused without reallocating.
+  void clear() {
+    for (size_t key : _heap) {
+      _positions[key] = NOT_IN_HEAP;
+    }
+    _heap.clear();
+  }
+
+  /// @brief Changes the number of keys, removing all of them.
+  /// @param capacity New number of keys.
+  void reset(size_t capacity) {
+    _heap.clear();
+    _positions.assign(capacity, NOT_IN_HEAP);
+    _priorities.resize(capacity);
+  }
+
+private:
+  static constexpr size_t NOT_IN_HEAP = std::numeric_limits<size_t>::max();
+
+  void place(size_t position, size_t key) {
+    _heap[position] = key;
+    _positions[key] = position;
+  }
+
+  void sift_up(size_t position) {
+    size_t key = _heap[position];
+    while (position > 0) {
+      size_t parent = (position - 1) / Arity;
+      if (!_compare(_priorities[key], _priorities[_heap[parent]])) {
+        break;
+      }
+      place(position, _heap[parent]);
+      position = parent;
+    }
+    place(position, key);
+  }
+
+  void sift_down(size_t position) {
+    size_t key = _heap[position];
+    while (true) {
+      size_t first_child = position * Arity + 1;
+      if (first_child >= _heap.size()) {
+        break;
+      }
+      size_t last_child = std::min(first_child + Arity, _heap.size());
+      size_t best = first_child;
+      for (size_t child = first_child + 1; child < last_child; ++child) {
+        if (_compare(_priorities[_heap[child]], _priorities[_heap[best]])) {
+          best = child;
+        }
+      }
+      if (!_compare(_priorities[_heap[best]], _priorities[key])) {
+        break;
+      }
+      place(position, _heap[best]);
+      position = best;
+    }
+    place(position, key);
+  }
+
+  /// @brief Keys in heap order.
+  std::vector<size_t> _heap;
+  /// @brief Position of every key in the heap, NOT_IN_HEAP if missing.
+  std::vector<size_t> _positions;
+  /// @brief Priority of every key.
+  std::vector<Priority> _priorities;
+  /// @brief Ordering of the priorities.
+  Compare _compare;
+};
+
+} // namespace graphxx::utils
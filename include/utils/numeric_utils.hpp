@@ -33,7 +33,7 @@
 #pragma once
 
 #include "graph_concepts.hpp" // concepts::Numeric
-#include <limits>             // std::numeric_limits::max()
+#include <limits>             // std::numeric_limits
 
 /// utils namespace contains all the utilities functions used throughout the project
 namespace graphxx::utils {
@@ -45,7 +45,7 @@ namespace graphxx::utils {
 /// @return true if the sum will overflow, false otherwise
 template <concepts::Numeric T> bool sum_will_overflow(T lhs, T rhs) {
   return lhs > 0 ? (std::numeric_limits<T>::max() - lhs) < rhs
-                 : (std::numeric_limits<T>::min() - lhs) > rhs;
+                 : (std::numeric_limits<T>::lowest() - lhs) > rhs;
 }
 
 } // namespace graphxx::utils
\ No newline at end of file
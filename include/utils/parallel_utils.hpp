@@ -0,0 +1,245 @@
+/**
+ * @file This file contains utility functions to run loops on multiple threads
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include <algorithm>  // std::min, std::sort, std::inplace_merge
+#include <atomic>     // std::atomic
+#include <concepts>   // std::integral
+#include <cstddef>    // std::ptrdiff_t
+#include <cstdint>    // size_t
+#include <exception>  // std::exception_ptr
+#include <functional> // std::less
+#include <iterator>   // std::random_access_iterator
+#include <thread>     // std::thread
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+/// utils namespace contains all the utilities functions used throughout the project
+namespace graphxx::utils {
+
+/// @brief Number of threads used by default by the parallel algorithms
+/// @return the number of concurrent threads supported by the hardware, at
+/// least one
+inline size_t default_num_threads() {
+  return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+/// @brief Splits the range [begin, end) in chunks of `grain` indices and
+/// distributes them dynamically among `num_threads` threads, calling
+/// `function(thread_id, first, last)` on each chunk. When the range fits in a
+/// single chunk, or a single thread is requested, everything runs on the
+/// calling thread. The first exception thrown by a thread is rethrown once all
+/// the threads have been joined.
+/// @tparam Index integral type of the indices
+/// @tparam Function type of the function to call
+/// @param begin first index of the range
+/// @param end one past the last index of the range
+/// @param function function called on every chunk
+/// @param num_threads maximum number of threads to use
+/// @param grain number of indices in each chunk
+template <std::integral Index, typename Function>
+void parallel_for_chunks(Index begin, Index end, Function &&function,
+                         size_t num_threads = default_num_threads(),
+                         Index grain = 1024) {
+  if (begin >= end) {
+    return;
+  }
+
+  grain = std::max<Index>(grain, 1);
+  size_t num_chunks = (static_cast<size_t>(end - begin) + grain - 1) / grain;
+  num_threads = std::min(std::max<size_t>(num_threads, 1), num_chunks);
+
+  if (num_threads == 1) {
+    function(size_t{0}, begin, end);
+    return;
+  }
+
+  std::atomic<size_t> next_chunk{0};
+  std::exception_ptr exception;
+  std::atomic<bool> failed{false};
+
+  auto worker = [&](size_t thread_id) {
+    try {
+      for (size_t chunk = next_chunk++; chunk < num_chunks;
+           chunk = next_chunk++) {
+        Index first = begin + static_cast<Index>(chunk * grain);
+        Index last = std::min<Index>(end, first + grain);
+        function(thread_id, first, last);
+      }
+    } catch (...) {
+      if (!failed.exchange(true)) {
+        exception = std::current_exception();
+      }
+      next_chunk = num_chunks;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t thread_id = 1; thread_id < num_threads; ++thread_id) {
+    threads.emplace_back(worker, thread_id);
+  }
+  worker(0);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+/// @brief Calls `function(index)` on every index of the range [begin, end),
+/// using up to `num_threads` threads.
+/// @tparam Index integral type of the indices
+/// @tparam Function type of the function to call
+/// @param begin first index of the range
+/// @param end one past the last index of the range
+/// @param function function called on every index
+/// @param num_threads maximum number of threads to use
+/// @param grain number of consecutive indices assigned to a thread at a time
+template <std::integral Index, typename Function>
+void parallel_for(Index begin, Index end, Function &&function,
+                  size_t num_threads = default_num_threads(),
+                  Index grain = 1024) {
+  parallel_for_chunks(
+      begin, end,
+      [&](size_t, Index first, Index last) {
+        for (Index index = first; index < last; ++index) {
+          function(index);
+        }
+      },
+      num_threads, grain);
+}
+
+/// @brief Calls `function(index, output)` on every index of the range
+/// [begin, end), using up to `num_threads` threads, where `output` is a vector
+/// owned by the calling thread. Returns the concatenation of all the outputs,
+/// so it can be used to build the next frontier of a parallel visit.
+/// @tparam T type of the collected elements
+/// @tparam Index integral type of the indices
+/// @tparam Function type of the function to call
+/// @param begin first index of the range
+/// @param end one past the last index of the range
+/// @param function function called on every index
+/// @param num_threads maximum number of threads to use
+/// @param grain number of consecutive indices assigned to a thread at a time
+/// @return the elements collected by all the threads
+template <typename T, std::integral Index, typename Function>
+std::vector<T> parallel_collect(Index begin, Index end, Function &&function,
+                                size_t num_threads = default_num_threads(),
+                                Index grain = 1024) {
+  std::vector<std::vector<T>> outputs(std::max<size_t>(num_threads, 1));
+
+  parallel_for_chunks(
+      begin, end,
+      [&](size_t thread_id, Index first, Index last) {
+        for (Index index = first; index < last; ++index) {
+          function(index, outputs[thread_id]);
+        }
+      },
+      num_threads, grain);
+
+  if (outputs.size() == 1) {
+    return std::move(outputs[0]);
+  }
+
+  size_t total = 0;
+  for (auto &output : outputs) {
+    total += output.size();
+  }
+
+  std::vector<T> collected;
+  collected.reserve(total);
+  for (auto &output : outputs) {
+    collected.insert(collected.end(), output.begin(), output.end());
+  }
+  return collected;
+}
+
+/// @brief Sorts the range [first, last) using up to `num_threads` threads.
+/// The range is split in one block per thread, the blocks are sorted
+/// concurrently and then merged pairwise, halving the number of blocks at
+/// every round. Ranges shorter than `grain` elements per thread are sorted on
+/// the calling thread.
+/// @tparam Iterator random access iterator type
+/// @tparam Compare type of the comparison function
+/// @param first beginning of the range
+/// @param last end of the range
+/// @param compare comparison function, as in std::sort
+/// @param num_threads maximum number of threads to use
+/// @param grain minimum number of elements sorted by a thread
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+void parallel_sort(Iterator first, Iterator last, Compare compare = {},
+                   size_t num_threads = default_num_threads(),
+                   size_t grain = 1 << 14) {
+  size_t size = static_cast<size_t>(last - first);
+  size_t num_blocks =
+      std::min(std::max<size_t>(num_threads, 1),
+               std::max<size_t>(size / std::max<size_t>(grain, 1), 1));
+
+  if (num_blocks == 1) {
+    std::sort(first, last, compare);
+    return;
+  }
+
+  std::vector<Iterator> bounds(num_blocks + 1);
+  for (size_t block = 0; block <= num_blocks; ++block) {
+    bounds[block] =
+        first + static_cast<std::ptrdiff_t>(size * block / num_blocks);
+  }
+
+  parallel_for(
+      size_t{0}, num_blocks,
+      [&](size_t block) {
+        std::sort(bounds[block], bounds[block + 1], compare);
+      },
+      num_blocks, size_t{1});
+
+  for (size_t width = 1; width < num_blocks; width *= 2) {
+    size_t num_merges = (num_blocks + 2 * width - 1) / (2 * width);
+    parallel_for(
+        size_t{0}, num_merges,
+        [&](size_t merge) {
+          size_t left = merge * 2 * width;
+          size_t middle = std::min(left + width, num_blocks);
+          size_t right = std::min(left + 2 * width, num_blocks);
+          std::inplace_merge(bounds[left], bounds[middle], bounds[right],
+                             compare);
+        },
+        num_merges, size_t{1});
+  }
+}
+
+} // namespace graphxx::utils
@@ -0,0 +1,102 @@
+/**
+ * @file This file contains the counter-based random number generator
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include <cstdint> // size_t, uint64_t
+#include <limits>  // std::numeric_limits
+
+/// utils namespace contains all the utilities functions used throughout the project
+namespace graphxx::utils {
+
+namespace detail::random {
+// Increment of the Weyl sequence of SplitMix64
+constexpr uint64_t GAMMA = 0x9E3779B97F4A7C15ULL;
+
+// SplitMix64 finalizer, a bijection with good avalanche
+inline uint64_t mix(uint64_t value) {
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  return value ^ (value >> 31);
+}
+} // namespace detail::random
+
+/// @brief Counter-based random number generator: the i-th number of a stream
+///        is a hash of the stream key and of i. Streams are created in
+///        constant time and hold two words, so a parallel algorithm can give
+///        every task its own stream, and the numbers drawn by a task do not
+///        depend on the thread that runs it. Satisfies the
+///        UniformRandomBitGenerator requirements.
+class CounterRng {
+public:
+  using result_type = uint64_t;
+
+  CounterRng() : CounterRng(0, 0) {}
+
+  /// @brief Creates a stream.
+  /// @param seed Seed shared by all the streams of a run.
+  /// @param stream Index of the stream, for instance the index of a task.
+  CounterRng(uint64_t seed, uint64_t stream)
+      : _key{detail::random::mix(detail::random::mix(seed) +
+                                 stream * detail::random::GAMMA)} {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /// @brief Get the next number of the stream.
+  result_type operator()() {
+    return detail::random::mix(_key + ++_counter * detail::random::GAMMA);
+  }
+
+  /// @brief Get a uniform number in [0, 1).
+  double uniform() { return static_cast<double>((*this)() >> 11) * 0x1p-53; }
+
+  /// @brief Get a uniform integer in [0, range), without modulo bias.
+  /// @param range Number of possible values, greater than zero.
+  uint64_t bounded(uint64_t range) {
+    // Values below the threshold would make the smaller results more likely
+    uint64_t threshold = (0 - range) % range;
+    uint64_t value = (*this)();
+    while (value < threshold) {
+      value = (*this)();
+    }
+    return value % range;
+  }
+
+private:
+  uint64_t _key;
+  uint64_t _counter = 0;
+};
+
+} // namespace graphxx::utils
@@ -0,0 +1,300 @@
+/**
+ * @file This file contains SIMD kernels over sorted arrays
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include <bit>      // std::popcount, std::countr_zero
+#include <concepts> // std::unsigned_integral
+#include <cstdint>  // size_t, uint8_t, uint64_t
+#include <span>     // std::span
+#include <utility>  // std::swap
+
+#ifdef __AVX2__
+#include <immintrin.h> // AVX2 intrinsics
+#endif
+
+/// utils namespace contains all the utilities functions used throughout the project
+namespace graphxx::utils {
+
+namespace detail::simd {
+// Size ratio above which the shorter array is searched in the longer one
+// instead of merging them
+constexpr size_t GALLOPING_RATIO = 32;
+
+// Scalar merge, writing the common elements only if out is not null
+template <std::unsigned_integral T>
+size_t merge_intersection(const T *lhs, const T *lhs_end, const T *rhs,
+                          const T *rhs_end, T *out) {
+  size_t count = 0;
+  while (lhs != lhs_end && rhs != rhs_end) {
+    if (*lhs < *rhs) {
+      ++lhs;
+    } else if (*rhs < *lhs) {
+      ++rhs;
+    } else {
+      if (out) {
+        out[count] = *lhs;
+      }
+      ++count;
+      ++lhs;
+      ++rhs;
+    }
+  }
+  return count;
+}
+
+// Looks for every element of the shorter array in the longer one, with an
+// exponential search followed by a binary one starting from the last match
+template <std::unsigned_integral T>
+size_t galloping_intersection(std::span<const T> small, std::span<const T> big,
+                              T *out) {
+  size_t count = 0;
+  size_t low = 0;
+  for (T value : small) {
+    size_t step = 1;
+    size_t high = low;
+    while (high < big.size() && big[high] < value) {
+      low = high + 1;
+      high += step;
+      step *= 2;
+    }
+    if (high > big.size()) {
+      high = big.size();
+    }
+    // The value, if present, is in [low, high]
+    while (low < high) {
+      size_t middle = low + (high - low) / 2;
+      if (big[middle] < value) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    if (low == big.size()) {
+      break;
+    }
+    if (big[low] == value) {
+      if (out) {
+        out[count] = value;
+      }
+      ++count;
+      ++low;
+    }
+  }
+  return count;
+}
+
+#ifdef __AVX2__
+// Appends the elements of a block selected by a comparison mask
+template <std::unsigned_integral T>
+size_t write_matches(const T *block, unsigned mask, T *out) {
+  size_t count = std::popcount(mask);
+  if (out) {
+    for (; mask != 0; mask &= mask - 1) {
+      *out++ = block[std::countr_zero(mask)];
+    }
+  }
+  return count;
+}
+
+// Compares blocks of eight 32 bit elements against all the rotations of each
+// other, advancing the block with the smaller last element
+template <std::unsigned_integral T>
+size_t avx2_intersection(const T *&lhs, const T *lhs_end, const T *&rhs,
+                         const T *rhs_end, T *out) {
+  static_assert(sizeof(T) == 4);
+  const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+  size_t count = 0;
+  while (lhs_end - lhs >= 8 && rhs_end - rhs >= 8) {
+    __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs));
+    __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs));
+    __m256i equal = _mm256_cmpeq_epi32(left, right);
+    for (int i = 1; i < 8; ++i) {
+      right = _mm256_permutevar8x32_epi32(right, rotate);
+      equal = _mm256_or_si256(equal, _mm256_cmpeq_epi32(left, right));
+    }
+    auto mask = static_cast<unsigned>(
+        _mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+    count += write_matches(lhs, mask, out ? out + count : nullptr);
+
+    T lhs_last = lhs[7];
+    T rhs_last = rhs[7];
+    lhs += lhs_last <= rhs_last ? 8 : 0;
+    rhs += rhs_last <= lhs_last ? 8 : 0;
+  }
+  return count;
+}
+
+// Same as above, with blocks of four 64 bit elements
+template <std::unsigned_integral T>
+size_t avx2_intersection_64(const T *&lhs, const T *lhs_end, const T *&rhs,
+                            const T *rhs_end, T *out) {
+  static_assert(sizeof(T) == 8);
+  size_t count = 0;
+  while (lhs_end - lhs >= 4 && rhs_end - rhs >= 4) {
+    __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs));
+    __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs));
+    __m256i equal = _mm256_or_si256(
+        _mm256_or_si256(
+            _mm256_cmpeq_epi64(left, right),
+            _mm256_cmpeq_epi64(left, _mm256_permute4x64_epi64(right, 0x39))),
+        _mm256_or_si256(
+            _mm256_cmpeq_epi64(left, _mm256_permute4x64_epi64(right, 0x4E)),
+            _mm256_cmpeq_epi64(left, _mm256_permute4x64_epi64(right, 0x93))));
+    auto mask = static_cast<unsigned>(
+        _mm256_movemask_pd(_mm256_castsi256_pd(equal)));
+    count += write_matches(lhs, mask, out ? out + count : nullptr);
+
+    T lhs_last = lhs[3];
+    T rhs_last = rhs[3];
+    lhs += lhs_last <= rhs_last ? 4 : 0;
+    rhs += rhs_last <= lhs_last ? 4 : 0;
+  }
+  return count;
+}
+#endif
+
+template <std::unsigned_integral T>
+size_t intersection(std::span<const T> lhs, std::span<const T> rhs, T *out) {
+  if (lhs.size() > rhs.size()) {
+    std::swap(lhs, rhs);
+  }
+  if (lhs.empty()) {
+    return 0;
+  }
+  if (rhs.size() / lhs.size() >= GALLOPING_RATIO) {
+    return galloping_intersection(lhs, rhs, out);
+  }
+
+  const T *left = lhs.data();
+  const T *left_end = left + lhs.size();
+  const T *right = rhs.data();
+  const T *right_end = right + rhs.size();
+  size_t count = 0;
+#ifdef __AVX2__
+  if constexpr (sizeof(T) == 4) {
+    count = avx2_intersection(left, left_end, right, right_end, out);
+  } else if constexpr (sizeof(T) == 8) {
+    count = avx2_intersection_64(left, left_end, right, right_end, out);
+  }
+#endif
+  return count + merge_intersection(left, left_end, right, right_end,
+                                    out ? out + count : nullptr);
+}
+
+// Byte-wise maximum, returning whether any byte of the target grew
+inline bool max_into(uint8_t *target, const uint8_t *source, size_t size) {
+  size_t i = 0;
+  bool changed = false;
+#ifdef __AVX2__
+  for (; i + 32 <= size; i += 32) {
+    auto *block = reinterpret_cast<__m256i *>(target + i);
+    __m256i old_block = _mm256_loadu_si256(block);
+    __m256i new_block = _mm256_max_epu8(
+        old_block,
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i)));
+    changed |= _mm256_movemask_epi8(_mm256_cmpeq_epi8(old_block, new_block)) !=
+               -1;
+    _mm256_storeu_si256(block, new_block);
+  }
+#endif
+  for (; i < size; ++i) {
+    changed |= source[i] > target[i];
+    target[i] = source[i] > target[i] ? source[i] : target[i];
+  }
+  return changed;
+}
+
+// Word-wise or, four words at a time with AVX2
+inline void or_into(uint64_t *target, const uint64_t *source, size_t size) {
+  size_t i = 0;
+#ifdef __AVX2__
+  for (; i + 4 <= size; i += 4) {
+    auto *block = reinterpret_cast<__m256i *>(target + i);
+    auto *other = reinterpret_cast<const __m256i *>(source + i);
+    _mm256_storeu_si256(block, _mm256_or_si256(_mm256_loadu_si256(block),
+                                               _mm256_loadu_si256(other)));
+  }
+#endif
+  for (; i < size; ++i) {
+    target[i] |= source[i];
+  }
+}
+} // namespace detail::simd
+
+/// @brief Counts the common elements of two sorted arrays without
+/// duplicates. Arrays of very different sizes are intersected by galloping
+/// through the longer one, the others are merged comparing blocks of elements
+/// at once with AVX2, when available, and one element at a time otherwise.
+/// @tparam T unsigned integral type of the elements
+/// @param lhs first sorted array
+/// @param rhs second sorted array
+/// @return the number of common elements
+template <std::unsigned_integral T>
+size_t intersection_size(std::span<const T> lhs, std::span<const T> rhs) {
+  return detail::simd::intersection<T>(lhs, rhs, nullptr);
+}
+
+/// @brief Writes the common elements of two sorted arrays without duplicates,
+/// in increasing order, as intersection_size does.
+/// @tparam T unsigned integral type of the elements
+/// @param lhs first sorted array
+/// @param rhs second sorted array
+/// @param out output buffer, with room for the smaller array
+/// @return the number of common elements written
+template <std::unsigned_integral T>
+size_t intersection(std::span<const T> lhs, std::span<const T> rhs, T *out) {
+  return detail::simd::intersection<T>(lhs, rhs, out);
+}
+
+/// @brief Replaces every byte of an array with the maximum between it and
+/// the byte at the same position of another array, 32 bytes at a time with
+/// AVX2, when available. This is the union of HyperLogLog registers.
+/// @param target array updated in place
+/// @param source array of the same size as target
+/// @return true if any byte of target changed
+inline bool max_into(std::span<uint8_t> target,
+                     std::span<const uint8_t> source) {
+  return detail::simd::max_into(target.data(), source.data(), target.size());
+}
+
+/// @brief Replaces every word of a bitset with its or with the word at the
+/// same position of another bitset, four words at a time with AVX2, when
+/// available. This is the union of the two sets.
+/// @param target bitset updated in place
+/// @param source bitset of the same size as target
+inline void or_into(std::span<uint64_t> target,
+                    std::span<const uint64_t> source) {
+  detail::simd::or_into(target.data(), source.data(), target.size());
+}
+
+} // namespace graphxx::utils
@@ -0,0 +1,161 @@
+/**
+ * @file This file contains the concurrent union-find structure
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#pragma once
+
+#include "graph_concepts.hpp" // concepts::Identifier
+
+#include <atomic>  // std::atomic_ref
+#include <cstdint> // size_t
+#include <numeric> // std::iota
+#include <utility> // std::swap
+#include <vector>  // std::vector
+
+/// utils namespace contains all the utilities functions used throughout the project
+namespace graphxx::utils {
+
+/// @brief Lock-free union-find over the elements [0, size). Sets are trees of
+///        parent pointers updated only with compare-and-swap, so find, unite
+///        and connected can be called concurrently by any number of threads.
+///        Roots are linked by index, the larger under the smaller, hence the
+///        representative of a set is always its smallest element; find halves
+///        the path it walks. Resizing is not thread safe.
+/// @tparam Id type of the elements
+template <concepts::Identifier Id> class ConcurrentUnionFind {
+public:
+  ConcurrentUnionFind() = default;
+
+  /// @brief Builds a structure where every element is a set by itself.
+  /// @param size Number of elements.
+  explicit ConcurrentUnionFind(size_t size) : _parents(size) {
+    std::iota(_parents.begin(), _parents.end(), Id{0});
+  }
+
+  /// @brief Get number of elements.
+  [[nodiscard]] size_t size() const { return _parents.size(); }
+
+  /// @brief Adds singleton sets up to the given number of elements.
+  /// @param size New number of elements, never smaller than the current one.
+  void resize(size_t size) {
+    size_t old_size = _parents.size();
+    if (size > old_size) {
+      _parents.resize(size);
+      std::iota(_parents.begin() + old_size, _parents.end(),
+                static_cast<Id>(old_size));
+    }
+  }
+
+  /// @brief Finds the representative of the set of an element, making every
+  /// visited element point to its grandparent.
+  /// @param element Element to look for.
+  /// @return The smallest element of the set.
+  Id find(Id element) {
+    while (true) {
+      Id parent = load(element);
+      if (parent == element) {
+        return element;
+      }
+      Id grandparent = load(parent);
+      if (grandparent == parent) {
+        return parent;
+      }
+      std::atomic_ref<Id>(_parents[element])
+          .compare_exchange_weak(parent, grandparent,
+                                 std::memory_order_relaxed);
+      element = grandparent;
+    }
+  }
+
+  /// @brief Merges the sets of two elements.
+  /// @param lhs First element.
+  /// @param rhs Second element.
+  /// @return true if the elements were in different sets, false otherwise.
+  bool unite(Id lhs, Id rhs) {
+    while (true) {
+      lhs = find(lhs);
+      rhs = find(rhs);
+      if (lhs == rhs) {
+        return false;
+      }
+      if (lhs < rhs) {
+        std::swap(lhs, rhs);
+      }
+      // lhs is the larger root: it is linked only if nobody linked it before
+      Id expected = lhs;
+      if (std::atomic_ref<Id>(_parents[lhs]).compare_exchange_strong(
+              expected, rhs, std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+  }
+
+  /// @brief Check if two elements are in the same set. The answer is exact
+  /// with respect to the unions completed before the call.
+  /// @param lhs First element.
+  /// @param rhs Second element.
+  /// @return true if the elements are in the same set, false otherwise.
+  bool connected(Id lhs, Id rhs) {
+    while (true) {
+      lhs = find(lhs);
+      rhs = find(rhs);
+      if (lhs == rhs) {
+        return true;
+      }
+      // If lhs is still a root, the sets were different at some point during
+      // the call
+      if (load(lhs) == lhs) {
+        return false;
+      }
+    }
+  }
+
+  /// @brief Get the representative of every element.
+  /// @return The smallest element of the set of every element.
+  std::vector<Id> labels() {
+    std::vector<Id> labels(_parents.size());
+    for (size_t element = 0; element < _parents.size(); ++element) {
+      labels[element] = find(static_cast<Id>(element));
+    }
+    return labels;
+  }
+
+private:
+  Id load(Id element) {
+    return std::atomic_ref<Id>(_parents[element])
+        .load(std::memory_order_relaxed);
+  }
+
+  /// @brief Parent of every element, the element itself for the roots.
+  std::vector<Id> _parents;
+};
+
+} // namespace graphxx::utils
@@ -85,7 +85,8 @@ bellman_ford(const G &graph, Vertex<G> source, Weight weight) {
       auto edge_source = graph.get_source(edge);
       auto edge_target = graph.get_target(edge);
 
-      if (!utils::sum_will_overflow(distance_tree[edge_source].distance,
+      if (distance_tree[edge_source].distance != distance_upperbound &&
+          !utils::sum_will_overflow(distance_tree[edge_source].distance,
                              weight(edge)) &&
           distance_tree[edge_source].distance + weight(edge) <
               distance_tree[edge_target].distance) {
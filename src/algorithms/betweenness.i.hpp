@@ -0,0 +1,331 @@
+/**
+ * @file This file is the header implementation of the betweenness centrality algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // make_csr
+#include "algorithms/betweenness.hpp"         // betweenness_centrality
+#include "base.hpp"                           // Vertex, Edge, Directedness
+#include "exceptions.hpp"                     // InvariantViolationException
+#include "graph_concepts.hpp"                 // Graph
+#include "utils/indexed_heap.hpp"             // IndexedHeap
+#include "utils/numeric_utils.hpp"            // sum_will_overflow
+#include "utils/parallel_utils.hpp"           // parallel_for_chunks
+
+#include <algorithm> // std::sample, std::max
+#include <cmath>     // std::ceil, std::log
+#include <cstdint>   // size_t
+#include <iterator>  // std::back_inserter
+#include <limits>    // std::numeric_limits
+#include <numeric>   // std::iota
+#include <optional>  // std::optional
+#include <random>    // std::mt19937
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::betweenness {
+// State of the visits of a thread, reset only on the visited vertices
+template <concepts::Identifier Id, typename Distance, bool weighted>
+struct Workspace {
+  static constexpr Distance UNREACHED = std::numeric_limits<Distance>::max();
+
+  explicit Workspace(size_t size)
+      : distance(size, UNREACHED), paths(size, 0), dependency(size, 0),
+        centrality(size, 0) {
+    order.reserve(size);
+    if constexpr (weighted) {
+      heap.reset(size);
+    }
+  }
+
+  std::vector<Distance> distance;
+  /// @brief Number of shortest paths from the source to every vertex.
+  std::vector<double> paths;
+  std::vector<double> dependency;
+  /// @brief Vertices by non decreasing distance from the source.
+  std::vector<Id> order;
+  /// @brief Centrality accumulated over the sources of the thread.
+  std::vector<double> centrality;
+  utils::IndexedHeap<Distance> heap;
+};
+
+// Counts the shortest paths from the source with a BFS, using the visit
+// order as queue
+template <concepts::Identifier Id, typename Distance>
+void count_paths(const CompressedSparseRow<Id> &csr,
+                 const std::vector<Distance> &, Id source,
+                 Workspace<Id, Distance, false> &workspace) {
+  auto &distance = workspace.distance;
+  auto &paths = workspace.paths;
+  auto &order = workspace.order;
+  distance[source] = 0;
+  paths[source] = 1;
+  order.push_back(source);
+
+  for (size_t next = 0; next < order.size(); ++next) {
+    Id vertex = order[next];
+    for (auto target : csr[vertex]) {
+      if (distance[target] == workspace.UNREACHED) {
+        distance[target] = distance[vertex] + 1;
+        order.push_back(target);
+      }
+      if (distance[target] == distance[vertex] + 1) {
+        paths[target] += paths[vertex];
+      }
+    }
+  }
+}
+
+// Counts the shortest paths from the source with Dijkstra, appending every
+// vertex to the order when it is settled
+template <concepts::Identifier Id, typename Distance>
+void count_paths(const CompressedSparseRow<Id> &csr,
+                 const std::vector<Distance> &weights, Id source,
+                 Workspace<Id, Distance, true> &workspace) {
+  auto &distance = workspace.distance;
+  auto &paths = workspace.paths;
+  auto &order = workspace.order;
+  auto &heap = workspace.heap;
+  distance[source] = 0;
+  paths[source] = 1;
+  heap.push(source, 0);
+
+  while (!heap.empty()) {
+    auto vertex = static_cast<Id>(heap.pop());
+    order.push_back(vertex);
+
+    for (size_t arc = csr.offsets()[vertex]; arc < csr.offsets()[vertex + 1];
+         ++arc) {
+      Id target = csr.targets()[arc];
+      if (utils::sum_will_overflow(distance[vertex], weights[arc])) {
+        continue;
+      }
+      Distance alternative = distance[vertex] + weights[arc];
+      if (alternative < distance[target]) {
+        distance[target] = alternative;
+        paths[target] = paths[vertex];
+        heap.push_or_decrease(target, alternative);
+      } else if (alternative == distance[target]) {
+        paths[target] += paths[vertex];
+      }
+    }
+  }
+}
+
+// Accumulates the dependencies of the source walking the visit order
+// backwards, finding the successors on the shortest paths through the out
+// edges, then resets the visited vertices
+template <concepts::Identifier Id, typename Distance, bool weighted>
+void accumulate(const CompressedSparseRow<Id> &csr,
+                const std::vector<Distance> &weights, Id source, double scale,
+                Workspace<Id, Distance, weighted> &workspace) {
+  auto &distance = workspace.distance;
+  auto &paths = workspace.paths;
+  auto &dependency = workspace.dependency;
+  auto &order = workspace.order;
+
+  for (size_t i = order.size(); i-- > 0;) {
+    Id vertex = order[i];
+    double sum = 0;
+    for (size_t arc = csr.offsets()[vertex]; arc < csr.offsets()[vertex + 1];
+         ++arc) {
+      Id target = csr.targets()[arc];
+      Distance length;
+      if constexpr (weighted) {
+        length = weights[arc];
+      } else {
+        length = 1;
+      }
+      // Same sum computed by the visit, so that ties are matched exactly
+      if (distance[target] != workspace.UNREACHED &&
+          !utils::sum_will_overflow(distance[vertex], length) &&
+          distance[vertex] + length == distance[target]) {
+        sum += (1 + dependency[target]) / paths[target];
+      }
+    }
+    dependency[vertex] = paths[vertex] * sum;
+    if (vertex != source) {
+      workspace.centrality[vertex] += scale * dependency[vertex];
+    }
+  }
+
+  for (auto vertex : order) {
+    distance[vertex] = workspace.UNREACHED;
+    paths[vertex] = 0;
+    dependency[vertex] = 0;
+  }
+  order.clear();
+}
+
+template <bool weighted, concepts::Identifier Id, typename Distance>
+std::vector<double> run(const CompressedSparseRow<Id> &csr,
+                        const std::vector<Distance> &weights,
+                        const std::vector<Id> &sources, double scale,
+                        size_t num_threads) {
+  size_t size = csr.num_vertices();
+  using WorkspaceType = Workspace<Id, Distance, weighted>;
+  std::vector<std::optional<WorkspaceType>> workspaces(
+      std::max<size_t>(num_threads, 1));
+
+  // Every source is a whole visit, so they are handed out one at a time
+  utils::parallel_for_chunks(
+      size_t{0}, sources.size(),
+      [&](size_t thread_id, size_t first, size_t last) {
+        auto &workspace = workspaces[thread_id];
+        if (!workspace) {
+          workspace.emplace(size);
+        }
+        for (size_t i = first; i < last; ++i) {
+          count_paths(csr, weights, sources[i], *workspace);
+          accumulate(csr, weights, sources[i], scale, *workspace);
+        }
+      },
+      num_threads, size_t{1});
+
+  std::vector<double> centrality(size, 0);
+  utils::parallel_for(
+      size_t{0}, size,
+      [&](size_t vertex) {
+        for (auto &workspace : workspaces) {
+          if (workspace) {
+            centrality[vertex] += workspace->centrality[vertex];
+          }
+        }
+      },
+      num_threads);
+
+  return centrality;
+}
+
+// Every source, or a uniform sample of distinct ones
+template <concepts::Identifier Id>
+std::vector<Id> sources(size_t size, size_t num_samples, unsigned int seed) {
+  std::vector<Id> all(size);
+  std::iota(all.begin(), all.end(), Id{0});
+  if (num_samples >= size) {
+    return all;
+  }
+
+  std::vector<Id> sample;
+  sample.reserve(num_samples);
+  std::sample(all.begin(), all.end(), std::back_inserter(sample), num_samples,
+              std::mt19937(seed));
+  return sample;
+}
+
+// Scale making the sum over the sources an unbiased estimate, halved for
+// undirected graphs, where every path is found from both its endpoints
+template <concepts::Graph G>
+double source_scale(size_t size, size_t num_sources) {
+  double factor = num_sources < size ? static_cast<double>(size) /
+                                           static_cast<double>(num_sources)
+                                     : 1.0;
+  return G::DIRECTEDNESS == Directedness::UNDIRECTED ? factor / 2 : factor;
+}
+
+// Edge weights in the order of the compressed sparse row of the out edges
+template <concepts::Graph G, typename Weight, typename Distance>
+std::vector<Distance> flat_weights(const G &graph, Weight &weight) {
+  std::vector<Distance> weights;
+  weights.reserve(graph.num_edges());
+  for (Vertex<G> vertex = 0; vertex < graph.num_vertices(); ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      Distance value = weight(edge);
+      if (value <= 0) {
+        throw exceptions::InvariantViolationException(
+            "non positive edge weight found");
+      }
+      weights.push_back(value);
+    }
+  }
+  return weights;
+}
+
+template <concepts::Graph G>
+std::vector<double> unweighted(const G &graph, size_t num_samples,
+                               unsigned int seed, size_t num_threads) {
+  size_t size = graph.num_vertices();
+  auto sampled = sources<Vertex<G>>(size, num_samples, seed);
+  return run<false>(make_csr(graph), std::vector<size_t>{}, sampled,
+                    source_scale<G>(size, sampled.size()), num_threads);
+}
+
+template <concepts::Graph G, typename Weight, typename Distance>
+std::vector<double> weighted(const G &graph, size_t num_samples,
+                             Weight &weight, unsigned int seed,
+                             size_t num_threads) {
+  size_t size = graph.num_vertices();
+  auto weights = flat_weights<G, Weight, Distance>(graph, weight);
+  auto sampled = sources<Vertex<G>>(size, num_samples, seed);
+  return run<true>(make_csr(graph), weights, sampled,
+                   source_scale<G>(size, sampled.size()), num_threads);
+}
+} // namespace detail::betweenness
+
+template <concepts::Graph G>
+std::vector<double> betweenness_centrality(const G &graph,
+                                           size_t num_threads) {
+  return detail::betweenness::unweighted(graph, graph.num_vertices(), 0,
+                                         num_threads);
+}
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+std::vector<double> weighted_betweenness_centrality(const G &graph,
+                                                    Weight weight,
+                                                    size_t num_threads) {
+  return detail::betweenness::weighted<G, Weight, Distance>(
+      graph, graph.num_vertices(), weight, 0, num_threads);
+}
+
+template <concepts::Graph G>
+std::vector<double>
+approximate_betweenness_centrality(const G &graph, size_t num_samples,
+                                   unsigned int seed, size_t num_threads) {
+  return detail::betweenness::unweighted(graph, num_samples, seed,
+                                         num_threads);
+}
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+std::vector<double> approximate_weighted_betweenness_centrality(
+    const G &graph, size_t num_samples, Weight weight, unsigned int seed,
+    size_t num_threads) {
+  return detail::betweenness::weighted<G, Weight, Distance>(
+      graph, num_samples, weight, seed, num_threads);
+}
+
+inline size_t betweenness_sample_size(size_t num_vertices, double epsilon,
+                                      double delta) {
+  return static_cast<size_t>(
+      std::ceil(std::log(2 * static_cast<double>(num_vertices) / delta) /
+                (2 * epsilon * epsilon)));
+}
+
+} // namespace graphxx::algorithms
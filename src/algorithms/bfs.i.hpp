@@ -31,63 +31,99 @@
  */
 
 #include "algorithms/bfs.hpp"  // bfs
-#include "algorithms_base.hpp" // VertexStatus
+#include "algorithms_base.hpp" // VertexStatus, Visitor
 #include "base.hpp"            // Vertex
 #include "graph_concepts.hpp"  // Graph
 
-#include <cstdint>    // size_t
-#include <functional> // std::function
-#include <limits>     // std::numeric_limits
-#include <queue>      // std::queue
-#include <vector>     // std::vector
+#include <concepts> // std::invocable
+#include <cstdint>  // size_t
+#include <limits>   // std::numeric_limits
+#include <queue>    // std::queue
+#include <vector>   // std::vector
 
 namespace graphxx::algorithms {
 
 template <concepts::Graph G>
 std::vector<BfsNode<Vertex<G>>> bfs(const G &graph, Vertex<G> source) {
-  return bfs(graph, source, [](Vertex<G>) {});
+  return bfs(graph, source, DefaultVisitor{});
 }
 
-template <concepts::Graph G>
-std::vector<BfsNode<Vertex<G>>>
-bfs(const G &graph, Vertex<G> source,
-    const std::function<void(Vertex<G>)> &callback) {
+template <concepts::Graph G, std::invocable<Vertex<G>> Callback>
+std::vector<BfsNode<Vertex<G>>> bfs(const G &graph, Vertex<G> source,
+                                    Callback &&callback) {
+  return bfs(graph, source, detail::CallbackVisitor<Callback>{callback});
+}
+
+template <concepts::Graph G, concepts::Visitor<G> Visitor>
+std::vector<BfsNode<Vertex<G>>> bfs(const G &graph, Vertex<G> source,
+                                    Visitor &&visitor) {
 
   using NodeType = BfsNode<Vertex<G>>;
-  std::vector<NodeType> distance_tree;
   constexpr auto distance_upperbound = std::numeric_limits<size_t>::max();
-
-  for (Vertex<G> vertex = 0; vertex < graph.num_vertices(); ++vertex) {
-    distance_tree.push_back(NodeType{.status = VertexStatus::READY,
+  std::vector<NodeType> distance_tree(
+      graph.num_vertices(), NodeType{.status = VertexStatus::READY,
                                      .distance = distance_upperbound,
                                      .parent = INVALID_VERTEX<G>});
-  }
-
-  distance_tree[source].status = VertexStatus::WAITING;
-  distance_tree[source].distance = 0;
 
   std::queue<Vertex<G>> queue;
-  queue.push(source);
+
+  // Marks the vertex as discovered and enqueues it, unless the visitor asks
+  // to skip it. Returns false if the visit has to stop
+  auto discover = [&](Vertex<G> vertex) {
+    distance_tree[vertex].status = VertexStatus::WAITING;
+
+    VisitorAction action = visitor.discover_vertex(vertex);
+    if (action == VisitorAction::SKIP) {
+      distance_tree[vertex].status = VertexStatus::PROCESSED;
+      return visitor.finish_vertex(vertex) != VisitorAction::STOP;
+    }
+
+    queue.push(vertex);
+    return action != VisitorAction::STOP;
+  };
+
+  distance_tree[source].distance = 0;
+  if (!discover(source)) {
+    return distance_tree;
+  }
 
   while (!queue.empty()) {
     Vertex<G> vertex_id = queue.front();
     queue.pop();
 
-    callback(vertex_id);
-
     for (auto &&edge : graph[vertex_id]) {
+      VisitorAction action = visitor.examine_edge(edge);
+      if (action == VisitorAction::STOP) {
+        return distance_tree;
+      }
+      if (action == VisitorAction::SKIP) {
+        continue;
+      }
+
       Vertex<G> adjacent = graph.get_target(edge);
 
       if (distance_tree[adjacent].status == VertexStatus::READY) {
-        distance_tree[adjacent].status = VertexStatus::WAITING;
+        action = visitor.tree_edge(edge);
+        if (action == VisitorAction::STOP) {
+          return distance_tree;
+        }
+        if (action == VisitorAction::SKIP) {
+          continue;
+        }
+
         distance_tree[adjacent].distance =
             distance_tree[vertex_id].distance + 1;
         distance_tree[adjacent].parent = vertex_id;
-        queue.push(adjacent);
+        if (!discover(adjacent)) {
+          return distance_tree;
+        }
       }
     }
 
     distance_tree[vertex_id].status = VertexStatus::PROCESSED;
+    if (visitor.finish_vertex(vertex_id) == VisitorAction::STOP) {
+      break;
+    }
   }
 
   return distance_tree;
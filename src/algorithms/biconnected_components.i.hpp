@@ -0,0 +1,155 @@
+/**
+ * @file This file is the header implementation of the biconnected components algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp"    // make_csr
+#include "algorithms/biconnected_components.hpp" // BiconnectedComponents
+#include "base.hpp"                              // Directedness
+#include "graph_concepts.hpp"                    // Graph, Identifier
+
+#include <algorithm> // std::min
+#include <cstdint>   // size_t
+#include <limits>    // std::numeric_limits
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+template <concepts::Identifier Id>
+BiconnectedComponents
+biconnected_components(const CompressedSparseRow<Id> &symmetric) {
+  constexpr auto UNVISITED = std::numeric_limits<size_t>::max();
+  constexpr auto NO_PARENT = std::numeric_limits<Id>::max();
+  constexpr auto NO_COMPONENT = BiconnectedComponents::NO_COMPONENT;
+
+  size_t size = symmetric.num_vertices();
+  const auto &offsets = symmetric.offsets();
+  const auto &targets = symmetric.targets();
+
+  BiconnectedComponents result{
+      std::vector<size_t>(symmetric.num_edges(), NO_COMPONENT), 0,
+      std::vector<bool>(size, false),
+      std::vector<bool>(symmetric.num_edges(), false)};
+
+  std::vector<size_t> discovery(size, UNVISITED);
+  std::vector<size_t> low(size);
+  std::vector<Id> parent(size, NO_PARENT);
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  std::vector<bool> parent_skipped(size, false);
+  // Vertices by discovery time
+  std::vector<Id> order;
+  order.reserve(size);
+  std::vector<Id> stack;
+
+  for (size_t root = 0; root < size; ++root) {
+    if (discovery[root] != UNVISITED) {
+      continue;
+    }
+    discovery[root] = low[root] = order.size();
+    order.push_back(static_cast<Id>(root));
+    stack.push_back(static_cast<Id>(root));
+    size_t root_children = 0;
+
+    while (!stack.empty()) {
+      Id vertex = stack.back();
+      if (next[vertex] == offsets[vertex + 1]) {
+        stack.pop_back();
+        if (parent[vertex] != NO_PARENT) {
+          low[parent[vertex]] = std::min(low[parent[vertex]], low[vertex]);
+        }
+        continue;
+      }
+
+      Id target = targets[next[vertex]++];
+      if (target == vertex) {
+        continue;
+      }
+      if (target == parent[vertex] && !parent_skipped[vertex]) {
+        parent_skipped[vertex] = true;
+        continue;
+      }
+      if (discovery[target] == UNVISITED) {
+        parent[target] = vertex;
+        discovery[target] = low[target] = order.size();
+        order.push_back(target);
+        stack.push_back(target);
+        root_children += vertex == root;
+      } else {
+        low[vertex] = std::min(low[vertex], discovery[target]);
+      }
+    }
+    result.articulation_point[root] = root_children > 1;
+  }
+
+  // Component of the tree edge entering every vertex, in discovery order so
+  // that the parent is assigned first
+  std::vector<size_t> tree_component(size, NO_COMPONENT);
+  for (auto child : order) {
+    Id vertex = parent[child];
+    if (vertex == NO_PARENT) {
+      continue;
+    }
+    if (low[child] >= discovery[vertex]) {
+      tree_component[child] = result.num_components++;
+      if (parent[vertex] != NO_PARENT) {
+        result.articulation_point[vertex] = true;
+      }
+    } else {
+      tree_component[child] = tree_component[vertex];
+    }
+  }
+
+  // Every edge joins a vertex to one of its ancestors, and lies on a cycle
+  // with the tree edge entering the deeper endpoint unless it is that edge
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    for (size_t position = offsets[vertex]; position < offsets[vertex + 1];
+         ++position) {
+      Id target = targets[position];
+      if (target == vertex) {
+        continue;
+      }
+      Id deeper = discovery[target] > discovery[vertex]
+                      ? target
+                      : static_cast<Id>(vertex);
+      result.edge_component[position] = tree_component[deeper];
+      result.bridge[position] = low[deeper] > discovery[parent[deeper]];
+    }
+  }
+
+  return result;
+}
+
+template <concepts::Graph G>
+requires(G::DIRECTEDNESS == Directedness::UNDIRECTED)
+BiconnectedComponents biconnected_components(const G &graph) {
+  return biconnected_components(make_csr(graph));
+}
+
+} // namespace graphxx::algorithms
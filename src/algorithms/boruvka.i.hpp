@@ -0,0 +1,200 @@
+/**
+ * @file This file is the header implementation of the parallel Boruvka algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "algorithms/boruvka.hpp"              // boruvka
+#include "algorithms/spanning_forest_base.hpp" // spanning_edges
+#include "base.hpp"                            // Edge
+#include "graph_concepts.hpp"                  // Graph
+#include "utils/parallel_utils.hpp"            // parallel_for, parallel_collect
+
+#include <algorithm> // std::sort
+#include <atomic>    // std::atomic_ref
+#include <cstdint>   // size_t
+#include <limits>    // std::numeric_limits
+#include <numeric>   // std::iota
+#include <utility>   // std::pair
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::boruvka {
+constexpr size_t NO_EDGE = std::numeric_limits<size_t>::max();
+
+// Strict order of the edges by weight and then by position: with distinct
+// keys, the lightest outgoing edges of the components never form a cycle
+template <typename Distance>
+bool lighter(const std::vector<Distance> &weights, size_t lhs, size_t rhs) {
+  return weights[lhs] < weights[rhs] ||
+         (weights[lhs] == weights[rhs] && lhs < rhs);
+}
+
+// Proposes an edge as the lightest outgoing edge of a component
+template <typename Distance>
+void propose(std::vector<size_t> &lightest, size_t component, size_t edge,
+             const std::vector<Distance> &weights) {
+  std::atomic_ref<size_t> slot(lightest[component]);
+  size_t current = slot.load(std::memory_order_relaxed);
+  while ((current == NO_EDGE || lighter(weights, edge, current)) &&
+         !slot.compare_exchange_weak(current, edge,
+                                     std::memory_order_relaxed)) {
+  }
+}
+} // namespace detail::boruvka
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+std::vector<Edge<G>> boruvka(const G &graph, Weight weight,
+                             size_t num_threads) {
+  using Id = Vertex<G>;
+  using detail::boruvka::NO_EDGE;
+
+  size_t size = graph.num_vertices();
+
+  std::vector<size_t> offsets =
+      detail::spanning_forest::number_spanning_candidates(graph, num_threads);
+  size_t num_edges = offsets[size];
+
+  std::vector<Distance> weights(num_edges);
+  std::vector<std::pair<Id, Id>> endpoints(num_edges);
+  utils::parallel_for(
+      size_t{0}, size,
+      [&](size_t vertex) {
+        size_t index = offsets[vertex];
+        for (auto &&edge : graph[vertex]) {
+          if (detail::spanning_forest::is_spanning_candidate(graph, edge)) {
+            weights[index] = weight(edge);
+            endpoints[index] = {graph.get_source(edge),
+                                graph.get_target(edge)};
+            ++index;
+          }
+        }
+      },
+      num_threads, size_t{256});
+
+  // Every vertex points to the representative of its component between two
+  // rounds
+  std::vector<Id> component(size);
+  std::iota(component.begin(), component.end(), Id{0});
+
+  std::vector<size_t> lightest(size, NO_EDGE);
+  std::vector<size_t> active(num_edges);
+  std::iota(active.begin(), active.end(), size_t{0});
+  std::vector<size_t> tree;
+
+  while (!active.empty()) {
+    utils::parallel_for(
+        size_t{0}, active.size(),
+        [&](size_t i) {
+          size_t edge = active[i];
+          auto [source, target] = endpoints[edge];
+          detail::boruvka::propose(lightest, component[source], edge, weights);
+          detail::boruvka::propose(lightest, component[target], edge, weights);
+        },
+        num_threads);
+
+    auto roots = utils::parallel_collect<Id>(
+        size_t{0}, size,
+        [&](size_t vertex, std::vector<Id> &output) {
+          if (lightest[vertex] != NO_EDGE) {
+            output.push_back(static_cast<Id>(vertex));
+          }
+        },
+        num_threads);
+
+    // When two components select the same edge, only the smaller one adds it
+    // and stays a representative, the other one hooks to it
+    std::vector<Id> others(roots.size());
+    auto selected = utils::parallel_collect<size_t>(
+        size_t{0}, roots.size(),
+        [&](size_t i, std::vector<size_t> &output) {
+          Id root = roots[i];
+          size_t edge = lightest[root];
+          auto [source, target] = endpoints[edge];
+          Id other = component[source] == root ? component[target]
+                                               : component[source];
+          others[i] = other;
+          if (lightest[other] != edge || root < other) {
+            output.push_back(edge);
+          }
+        },
+        num_threads);
+
+    utils::parallel_for(
+        size_t{0}, roots.size(),
+        [&](size_t i) {
+          Id root = roots[i];
+          Id other = others[i];
+          if (lightest[other] != lightest[root] || root > other) {
+            component[root] = other;
+          }
+        },
+        num_threads);
+
+    utils::parallel_for(
+        size_t{0}, roots.size(),
+        [&](size_t i) { lightest[roots[i]] = NO_EDGE; }, num_threads);
+
+    // Pointer jumping, so that every vertex points to its representative
+    utils::parallel_for(
+        size_t{0}, size,
+        [&](size_t vertex) {
+          Id root = static_cast<Id>(vertex);
+          Id parent;
+          while ((parent = std::atomic_ref<Id>(component[root]).load(
+                      std::memory_order_relaxed)) != root) {
+            root = parent;
+          }
+          std::atomic_ref<Id>(component[vertex])
+              .store(root, std::memory_order_relaxed);
+        },
+        num_threads);
+
+    tree.insert(tree.end(), selected.begin(), selected.end());
+
+    active = utils::parallel_collect<size_t>(
+        size_t{0}, active.size(),
+        [&](size_t i, std::vector<size_t> &output) {
+          auto [source, target] = endpoints[active[i]];
+          if (component[source] != component[target]) {
+            output.push_back(active[i]);
+          }
+        },
+        num_threads);
+  }
+
+  std::sort(tree.begin(), tree.end(), [&](size_t lhs, size_t rhs) {
+    return detail::boruvka::lighter(weights, lhs, rhs);
+  });
+
+  return detail::spanning_forest::spanning_edges(graph, offsets, tree);
+}
+
+} // namespace graphxx::algorithms
@@ -0,0 +1,203 @@
+/**
+ * @file This file is the header implementation of the vertex coloring algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // make_symmetric_csr
+#include "algorithms/coloring.hpp"            // Coloring, ColoringOrder
+#include "algorithms/k_core.hpp"              // detail::k_core::peel
+#include "graph_concepts.hpp"                 // Graph, Identifier
+#include "utils/parallel_utils.hpp" // parallel_for_chunks, parallel_collect
+
+#include <algorithm> // std::reverse, std::stable_sort, std::max
+#include <atomic>    // std::atomic_ref
+#include <cstdint>   // size_t
+#include <limits>    // std::numeric_limits
+#include <optional>  // std::optional
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::coloring {
+// Number of vertices assigned to a thread at a time
+constexpr size_t GRAIN = 256;
+// Color of the vertices not colored yet
+constexpr size_t UNCOLORED = std::numeric_limits<size_t>::max();
+
+// Colors used by the neighbours of a vertex, marked with a stamp that changes
+// for every vertex so that the marks never need to be cleared
+class ForbiddenColors {
+public:
+  explicit ForbiddenColors(size_t max_degree)
+      : _stamp_of(max_degree + 1, 0) {}
+
+  // Smallest color not returned by load for the neighbours of the vertex.
+  // A vertex of degree d forbids at most d colors, so the result is at most d
+  template <concepts::Identifier Id, typename Load>
+  size_t first_fit(const CompressedSparseRow<Id> &symmetric, Id vertex,
+                   Load &&load) {
+    ++_stamp;
+    for (auto neighbour : symmetric[vertex]) {
+      size_t color = load(neighbour);
+      if (color != UNCOLORED && color < _stamp_of.size()) {
+        _stamp_of[color] = _stamp;
+      }
+    }
+    size_t color = 0;
+    while (_stamp_of[color] == _stamp) {
+      ++color;
+    }
+    return color;
+  }
+
+private:
+  std::vector<size_t> _stamp_of;
+  size_t _stamp = 0;
+};
+
+template <concepts::Identifier Id>
+size_t max_degree(const CompressedSparseRow<Id> &symmetric) {
+  size_t result = 0;
+  for (size_t vertex = 0; vertex < symmetric.num_vertices(); ++vertex) {
+    result = std::max(result, symmetric.degree(static_cast<Id>(vertex)));
+  }
+  return result;
+}
+
+inline Coloring make_coloring(std::vector<size_t> color) {
+  size_t num_colors = 0;
+  for (auto c : color) {
+    num_colors = std::max(num_colors, c + 1);
+  }
+  return {std::move(color), num_colors};
+}
+} // namespace detail::coloring
+
+template <concepts::Identifier Id>
+Coloring greedy_coloring(const CompressedSparseRow<Id> &symmetric,
+                         ColoringOrder order) {
+  using detail::coloring::UNCOLORED;
+
+  size_t size = symmetric.num_vertices();
+  std::vector<Id> sequence;
+  if (order == ColoringOrder::SMALLEST_LAST) {
+    sequence = detail::k_core::peel(symmetric).order;
+    std::reverse(sequence.begin(), sequence.end());
+  } else {
+    sequence.resize(size);
+    for (size_t vertex = 0; vertex < size; ++vertex) {
+      sequence[vertex] = static_cast<Id>(vertex);
+    }
+    std::stable_sort(sequence.begin(), sequence.end(), [&](Id a, Id b) {
+      return symmetric.degree(a) > symmetric.degree(b);
+    });
+  }
+
+  std::vector<size_t> color(size, UNCOLORED);
+  detail::coloring::ForbiddenColors forbidden(
+      detail::coloring::max_degree(symmetric));
+  for (auto vertex : sequence) {
+    color[vertex] = forbidden.first_fit(
+        symmetric, vertex, [&](Id neighbour) { return color[neighbour]; });
+  }
+
+  return detail::coloring::make_coloring(std::move(color));
+}
+
+template <concepts::Graph G>
+Coloring greedy_coloring(const G &graph, ColoringOrder order) {
+  return greedy_coloring(make_symmetric_csr(graph), order);
+}
+
+template <concepts::Identifier Id>
+Coloring parallel_coloring(const CompressedSparseRow<Id> &symmetric,
+                           size_t num_threads) {
+  using detail::coloring::ForbiddenColors;
+  using detail::coloring::GRAIN;
+  using detail::coloring::UNCOLORED;
+
+  size_t size = symmetric.num_vertices();
+  size_t max_degree = detail::coloring::max_degree(symmetric);
+  std::vector<size_t> color(size, UNCOLORED);
+  std::vector<std::optional<ForbiddenColors>> workspaces(
+      std::max(num_threads, size_t{1}));
+
+  std::vector<Id> worklist(size);
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    worklist[vertex] = static_cast<Id>(vertex);
+  }
+
+  while (!worklist.empty()) {
+    // Tentative coloring, reading colors that other threads may be writing
+    utils::parallel_for_chunks(
+        size_t{0}, worklist.size(),
+        [&](size_t thread_id, size_t first, size_t last) {
+          auto &forbidden = workspaces[thread_id];
+          if (!forbidden) {
+            forbidden.emplace(max_degree);
+          }
+          for (size_t index = first; index < last; ++index) {
+            Id vertex = worklist[index];
+            size_t chosen =
+                forbidden->first_fit(symmetric, vertex, [&](Id neighbour) {
+                  return std::atomic_ref<size_t>(color[neighbour])
+                      .load(std::memory_order_relaxed);
+                });
+            std::atomic_ref<size_t>(color[vertex])
+                .store(chosen, std::memory_order_relaxed);
+          }
+        },
+        num_threads, GRAIN);
+
+    // Of two adjacent vertices with the same color, the larger is recolored
+    worklist = utils::parallel_collect<Id>(
+        size_t{0}, worklist.size(),
+        [&](size_t index, std::vector<Id> &output) {
+          Id vertex = worklist[index];
+          for (auto neighbour : symmetric[vertex]) {
+            if (neighbour < vertex && color[neighbour] == color[vertex]) {
+              output.push_back(vertex);
+              break;
+            }
+          }
+        },
+        num_threads, GRAIN);
+  }
+
+  return detail::coloring::make_coloring(std::move(color));
+}
+
+template <concepts::Graph G>
+Coloring parallel_coloring(const G &graph, size_t num_threads) {
+  return parallel_coloring(make_symmetric_csr(graph, num_threads),
+                           num_threads);
+}
+
+} // namespace graphxx::algorithms
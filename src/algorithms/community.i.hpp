@@ -0,0 +1,529 @@
+/**
+ * @file This file is the header implementation of the community detection algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "algorithms/community.hpp" // louvain
+#include "base.hpp"                 // Vertex, Edge, Directedness
+#include "exceptions.hpp"           // InvariantViolationException
+#include "graph_concepts.hpp"       // Graph, Identifier
+#include "utils/parallel_utils.hpp" // parallel_for, parallel_for_chunks
+
+#include <algorithm> // std::sort, std::copy, std::max
+#include <atomic>    // std::atomic, std::atomic_ref
+#include <cstdint>   // size_t, uint64_t
+#include <limits>    // std::numeric_limits
+#include <numeric>   // std::iota
+#include <optional>  // std::optional
+#include <utility>   // std::pair
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::community {
+// Number of vertices assigned to a thread at a time
+constexpr size_t GRAIN = 256;
+// Maximum number of sweeps of the local moving phase of every level
+constexpr size_t MAX_MOVING_ROUNDS = 32;
+
+// Symmetric weighted adjacency without parallel edges. A self loop is a
+// single entry with twice its weight, so that every row sums up to the
+// weighted degree of its vertex
+template <concepts::Identifier Id> struct WeightedGraph {
+  std::vector<size_t> offsets;
+  std::vector<Id> targets;
+  std::vector<double> weights;
+  std::vector<double> degree;
+  /// @brief Sum of the weighted degrees, that is twice the total weight.
+  double total_weight = 0;
+
+  [[nodiscard]] size_t num_vertices() const { return offsets.size() - 1; }
+};
+
+// Sums weights by key, remembering the keys touched since the last clear
+template <concepts::Identifier Id> class Accumulator {
+public:
+  explicit Accumulator(size_t size) : _weights(size, 0), _touched(size, 0) {}
+
+  void add(Id key, double weight) {
+    if (!_touched[key]) {
+      _touched[key] = 1;
+      _keys.push_back(key);
+    }
+    _weights[key] += weight;
+  }
+
+  double operator[](Id key) const { return _weights[key]; }
+
+  std::vector<Id> &keys() { return _keys; }
+
+  void clear() {
+    for (auto key : _keys) {
+      _weights[key] = 0;
+      _touched[key] = 0;
+    }
+    _keys.clear();
+  }
+
+private:
+  std::vector<double> _weights;
+  std::vector<char> _touched;
+  std::vector<Id> _keys;
+};
+
+// Scrambles a label with a salt, to break ties between labels
+inline uint64_t mix(uint64_t label, uint64_t salt) {
+  uint64_t x = label * 0x9E3779B97F4A7C15ULL ^ salt;
+  x ^= x >> 31;
+  x *= 0xBF58476D1CE4E5B9ULL;
+  return x ^ (x >> 29);
+}
+
+template <typename T> T load(T &value) {
+  return std::atomic_ref<T>(value).load(std::memory_order_relaxed);
+}
+
+// Builds the rows from unsorted entries, merging the entries with the same
+// target
+template <concepts::Identifier Id>
+WeightedGraph<Id> compress(std::vector<size_t> offsets,
+                           std::vector<std::pair<Id, double>> entries,
+                           size_t num_threads) {
+  size_t size = offsets.size() - 1;
+  std::vector<size_t> lengths(size + 1, 0);
+  utils::parallel_for(
+      size_t{0}, size,
+      [&](size_t vertex) {
+        auto first = entries.begin() + offsets[vertex];
+        auto last = entries.begin() + offsets[vertex + 1];
+        std::sort(first, last, [](auto &lhs, auto &rhs) {
+          return lhs.first < rhs.first;
+        });
+        auto out = first;
+        for (auto it = first; it != last; ++it) {
+          if (out != first && (out - 1)->first == it->first) {
+            (out - 1)->second += it->second;
+          } else {
+            *out++ = *it;
+          }
+        }
+        lengths[vertex + 1] = out - first;
+      },
+      num_threads);
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    lengths[vertex + 1] += lengths[vertex];
+  }
+
+  WeightedGraph<Id> graph;
+  graph.targets.resize(lengths.back());
+  graph.weights.resize(lengths.back());
+  graph.degree.resize(size);
+  utils::parallel_for(
+      size_t{0}, size,
+      [&](size_t vertex) {
+        double degree = 0;
+        for (size_t i = 0; i < lengths[vertex + 1] - lengths[vertex]; ++i) {
+          auto &[target, weight] = entries[offsets[vertex] + i];
+          graph.targets[lengths[vertex] + i] = target;
+          graph.weights[lengths[vertex] + i] = weight;
+          degree += weight;
+        }
+        graph.degree[vertex] = degree;
+      },
+      num_threads);
+  graph.offsets = std::move(lengths);
+  for (auto degree : graph.degree) {
+    graph.total_weight += degree;
+  }
+
+  return graph;
+}
+
+template <concepts::Graph G, typename Weight>
+WeightedGraph<Vertex<G>> build(const G &graph, Weight &weight,
+                               size_t num_threads) {
+  using Id = Vertex<G>;
+  constexpr bool directed = G::DIRECTEDNESS == Directedness::DIRECTED;
+  size_t size = graph.num_vertices();
+
+  // Undirected graphs already store both directions of every edge
+  std::vector<size_t> offsets(size + 1, 0);
+  for (Id vertex = 0; vertex < size; ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      ++offsets[vertex + 1];
+      if constexpr (directed) {
+        ++offsets[graph.get_target(edge) + 1];
+      }
+    }
+  }
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    offsets[vertex + 1] += offsets[vertex];
+  }
+
+  std::vector<std::pair<Id, double>> entries(offsets.back());
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for (Id vertex = 0; vertex < size; ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      auto value = static_cast<double>(weight(edge));
+      if (value < 0) {
+        throw exceptions::InvariantViolationException(
+            "negative edge weight found");
+      }
+      Id target = graph.get_target(edge);
+      if constexpr (directed) {
+        entries[next[vertex]++] = {target, value};
+        entries[next[target]++] = {vertex, value};
+      } else {
+        entries[next[vertex]++] = {target, target == vertex ? 2 * value
+                                                            : value};
+      }
+    }
+  }
+
+  return compress(std::move(offsets), std::move(entries), num_threads);
+}
+
+// Contracts every community into a vertex, summing the weights between them
+template <concepts::Identifier Id>
+WeightedGraph<Id> coarsen(const WeightedGraph<Id> &graph,
+                          const std::vector<Id> &community,
+                          size_t num_communities, size_t num_threads) {
+  size_t size = graph.num_vertices();
+  std::vector<size_t> member_offsets(num_communities + 1, 0);
+  for (auto c : community) {
+    ++member_offsets[c + 1];
+  }
+  for (size_t c = 0; c < num_communities; ++c) {
+    member_offsets[c + 1] += member_offsets[c];
+  }
+  std::vector<Id> members(size);
+  {
+    std::vector<size_t> next(member_offsets.begin(), member_offsets.end() - 1);
+    for (size_t vertex = 0; vertex < size; ++vertex) {
+      members[next[community[vertex]]++] = static_cast<Id>(vertex);
+    }
+  }
+
+  std::vector<std::vector<std::pair<Id, double>>> rows(num_communities);
+  std::vector<std::optional<Accumulator<Id>>> accumulators(
+      std::max<size_t>(num_threads, 1));
+  utils::parallel_for_chunks(
+      size_t{0}, num_communities,
+      [&](size_t thread_id, size_t first, size_t last) {
+        auto &accumulator = accumulators[thread_id];
+        if (!accumulator) {
+          accumulator.emplace(num_communities);
+        }
+        for (size_t c = first; c < last; ++c) {
+          for (size_t m = member_offsets[c]; m < member_offsets[c + 1]; ++m) {
+            Id vertex = members[m];
+            for (size_t i = graph.offsets[vertex];
+                 i < graph.offsets[vertex + 1]; ++i) {
+              accumulator->add(community[graph.targets[i]], graph.weights[i]);
+            }
+          }
+          auto &keys = accumulator->keys();
+          std::sort(keys.begin(), keys.end());
+          rows[c].reserve(keys.size());
+          for (auto key : keys) {
+            rows[c].emplace_back(key, (*accumulator)[key]);
+          }
+          accumulator->clear();
+        }
+      },
+      num_threads, GRAIN);
+
+  std::vector<size_t> offsets(num_communities + 1, 0);
+  for (size_t c = 0; c < num_communities; ++c) {
+    offsets[c + 1] = offsets[c] + rows[c].size();
+  }
+  std::vector<std::pair<Id, double>> entries(offsets.back());
+  utils::parallel_for(
+      size_t{0}, num_communities,
+      [&](size_t c) {
+        std::copy(rows[c].begin(), rows[c].end(),
+                  entries.begin() + offsets[c]);
+      },
+      num_threads);
+
+  return compress(std::move(offsets), std::move(entries), num_threads);
+}
+
+// Numbers the labels from zero, in order of first appearance
+template <concepts::Identifier Id> size_t relabel(std::vector<Id> &labels) {
+  constexpr Id INVALID = std::numeric_limits<Id>::max();
+  std::vector<Id> dense(labels.size(), INVALID);
+  size_t count = 0;
+  for (auto &label : labels) {
+    if (dense[label] == INVALID) {
+      dense[label] = static_cast<Id>(count++);
+    }
+    label = dense[label];
+  }
+  return count;
+}
+
+template <concepts::Identifier Id>
+double modularity(const WeightedGraph<Id> &graph,
+                  const std::vector<Id> &community) {
+  if (graph.total_weight == 0) {
+    return 0;
+  }
+
+  std::vector<double> community_degree(graph.num_vertices(), 0);
+  double inside = 0;
+  for (size_t vertex = 0; vertex < graph.num_vertices(); ++vertex) {
+    community_degree[community[vertex]] += graph.degree[vertex];
+    for (size_t i = graph.offsets[vertex]; i < graph.offsets[vertex + 1];
+         ++i) {
+      if (community[graph.targets[i]] == community[vertex]) {
+        inside += graph.weights[i];
+      }
+    }
+  }
+
+  double expected = 0;
+  for (auto degree : community_degree) {
+    expected += degree * degree;
+  }
+  return inside / graph.total_weight -
+         expected / (graph.total_weight * graph.total_weight);
+}
+
+// Local moving phase of a level, starting from singletons. Returns whether
+// any vertex moved
+template <concepts::Identifier Id>
+bool move_vertices(const WeightedGraph<Id> &graph, std::vector<Id> &community,
+                   size_t num_threads) {
+  size_t size = graph.num_vertices();
+  std::iota(community.begin(), community.end(), Id{0});
+  std::vector<double> community_degree = graph.degree;
+  std::vector<size_t> community_size(size, 1);
+
+  std::vector<std::optional<Accumulator<Id>>> accumulators(
+      std::max<size_t>(num_threads, 1));
+  bool moved_any = false;
+
+  for (size_t round = 0; round < MAX_MOVING_ROUNDS; ++round) {
+    std::atomic<size_t> moved = 0;
+    utils::parallel_for_chunks(
+        size_t{0}, size,
+        [&](size_t thread_id, size_t first, size_t last) {
+          auto &accumulator = accumulators[thread_id];
+          if (!accumulator) {
+            accumulator.emplace(size);
+          }
+          size_t moved_here = 0;
+          for (size_t vertex = first; vertex < last; ++vertex) {
+            Id own = load(community[vertex]);
+            for (size_t i = graph.offsets[vertex];
+                 i < graph.offsets[vertex + 1]; ++i) {
+              if (graph.targets[i] != vertex) {
+                accumulator->add(load(community[graph.targets[i]]),
+                                 graph.weights[i]);
+              }
+            }
+
+            // Gain of joining a community, up to terms common to all of
+            // them, once the vertex has left its own
+            double degree = graph.degree[vertex];
+            auto gain = [&](Id c) {
+              double other = load(community_degree[c]);
+              if (c == own) {
+                other -= degree;
+              }
+              return (*accumulator)[c] -
+                     other * degree / graph.total_weight;
+            };
+
+            Id best = own;
+            double best_gain = gain(own);
+            bool alone = load(community_size[own]) == 1;
+            for (auto c : accumulator->keys()) {
+              if (c == own ||
+                  (alone && c > own && load(community_size[c]) == 1)) {
+                continue;
+              }
+              double value = gain(c);
+              if (value > best_gain ||
+                  (value == best_gain && best != own && c < best)) {
+                best = c;
+                best_gain = value;
+              }
+            }
+            accumulator->clear();
+
+            if (best != own) {
+              std::atomic_ref<double>(community_degree[own])
+                  .fetch_sub(degree, std::memory_order_relaxed);
+              std::atomic_ref<double>(community_degree[best])
+                  .fetch_add(degree, std::memory_order_relaxed);
+              std::atomic_ref<size_t>(community_size[own])
+                  .fetch_sub(1, std::memory_order_relaxed);
+              std::atomic_ref<size_t>(community_size[best])
+                  .fetch_add(1, std::memory_order_relaxed);
+              std::atomic_ref<Id>(community[vertex])
+                  .store(best, std::memory_order_relaxed);
+              ++moved_here;
+            }
+          }
+          moved += moved_here;
+        },
+        num_threads, GRAIN);
+
+    if (moved == 0) {
+      break;
+    }
+    moved_any = true;
+  }
+
+  return moved_any;
+}
+} // namespace detail::community
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+Communities<Vertex<G>> label_propagation(const G &graph, Weight weight,
+                                         size_t max_iterations,
+                                         size_t num_threads) {
+  using Id = Vertex<G>;
+  using detail::community::load;
+
+  auto base = detail::community::build(graph, weight, num_threads);
+  size_t size = base.num_vertices();
+  std::vector<Id> label(size);
+  std::iota(label.begin(), label.end(), Id{0});
+
+  std::vector<std::optional<detail::community::Accumulator<Id>>> accumulators(
+      std::max<size_t>(num_threads, 1));
+  for (size_t iteration = 0; iteration < max_iterations; ++iteration) {
+    std::atomic<size_t> changed = 0;
+    utils::parallel_for_chunks(
+        size_t{0}, size,
+        [&](size_t thread_id, size_t first, size_t last) {
+          auto &accumulator = accumulators[thread_id];
+          if (!accumulator) {
+            accumulator.emplace(size);
+          }
+          size_t changed_here = 0;
+          for (size_t vertex = first; vertex < last; ++vertex) {
+            for (size_t i = base.offsets[vertex]; i < base.offsets[vertex + 1];
+                 ++i) {
+              if (base.targets[i] != vertex) {
+                accumulator->add(load(label[base.targets[i]]),
+                                 base.weights[i]);
+              }
+            }
+
+            // Keep the own label among the heaviest ones, otherwise break
+            // the tie by a hash of the labels salted with the vertex, since
+            // always taking the smallest label floods the whole graph
+            Id own = load(label[vertex]);
+            Id best = own;
+            double best_weight = (*accumulator)[own];
+            auto rank = [&](Id c) {
+              return detail::community::mix(c, vertex);
+            };
+            for (auto c : accumulator->keys()) {
+              double value = (*accumulator)[c];
+              if (value > best_weight || (value == best_weight && best != own &&
+                                          rank(c) < rank(best))) {
+                best = c;
+                best_weight = value;
+              }
+            }
+            accumulator->clear();
+
+            if (best != own) {
+              std::atomic_ref<Id>(label[vertex])
+                  .store(best, std::memory_order_relaxed);
+              ++changed_here;
+            }
+          }
+          changed += changed_here;
+        },
+        num_threads, detail::community::GRAIN);
+
+    if (changed == 0) {
+      break;
+    }
+  }
+
+  size_t num_communities = detail::community::relabel(label);
+  double value = detail::community::modularity(base, label);
+  return {std::move(label), num_communities, value};
+}
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+Communities<Vertex<G>> louvain(const G &graph, Weight weight,
+                               size_t num_threads) {
+  using Id = Vertex<G>;
+
+  auto base = detail::community::build(graph, weight, num_threads);
+  size_t size = base.num_vertices();
+  // Community of every vertex of the input graph, which is a vertex of the
+  // current level
+  std::vector<Id> assignment(size);
+  std::iota(assignment.begin(), assignment.end(), Id{0});
+  size_t num_communities = size;
+
+  auto level = base;
+  while (true) {
+    std::vector<Id> community(level.num_vertices());
+    if (!detail::community::move_vertices(level, community, num_threads)) {
+      break;
+    }
+
+    num_communities = detail::community::relabel(community);
+    utils::parallel_for(
+        size_t{0}, size,
+        [&](size_t vertex) {
+          assignment[vertex] = community[assignment[vertex]];
+        },
+        num_threads);
+    if (num_communities == level.num_vertices()) {
+      break;
+    }
+
+    level = detail::community::coarsen(level, community, num_communities,
+                                       num_threads);
+  }
+
+  double value = detail::community::modularity(base, assignment);
+  return {std::move(assignment), num_communities, value};
+}
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+double modularity(const G &graph, const std::vector<Vertex<G>> &community,
+                  Weight weight) {
+  auto base = detail::community::build(graph, weight, size_t{1});
+  return detail::community::modularity(base, community);
+}
+
+} // namespace graphxx::algorithms
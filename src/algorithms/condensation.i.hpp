@@ -0,0 +1,174 @@
+/**
+ * @file This file is the header implementation of the graph condensation
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "algorithms/condensation.hpp"        // condensation
+#include "base.hpp"                           // Vertex
+#include "graph_concepts.hpp"                 // Graph
+
+#include <algorithm> // std::min
+#include <cstdint>   // size_t
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::condensation {
+/// @brief Builds the condensation, aggregating the weights only when
+/// weighted is true. Edges between different components are first sorted by
+/// target component, then stably by source component, so that the targets of
+/// every source end up sorted and duplicates are adjacent.
+template <bool weighted, typename Distance, concepts::Graph G, typename Weight>
+WeightedCondensation<Vertex<G>, Distance>
+build(const G &graph, const std::vector<Vertex<G>> &component,
+      size_t num_components, Weight &weight) {
+  using Id = Vertex<G>;
+
+  std::vector<size_t> by_target(num_components + 1, 0);
+  std::vector<size_t> by_source(num_components + 1, 0);
+  for (size_t v = 0; v < graph.num_vertices(); ++v) {
+    for (auto &&edge : graph[v]) {
+      Id source = component[graph.get_source(edge)];
+      Id target = component[graph.get_target(edge)];
+      if (source != target) {
+        ++by_target[target + 1];
+        ++by_source[source + 1];
+      }
+    }
+  }
+  for (size_t c = 0; c < num_components; ++c) {
+    by_target[c + 1] += by_target[c];
+    by_source[c + 1] += by_source[c];
+  }
+  size_t num_arcs = by_source[num_components];
+
+  // First pass: sources and weights grouped by target component
+  std::vector<Id> sources(num_arcs);
+  std::vector<Distance> weights(weighted ? num_arcs : 0);
+  {
+    std::vector<size_t> next(by_target.begin(), by_target.end() - 1);
+    for (size_t v = 0; v < graph.num_vertices(); ++v) {
+      for (auto &&edge : graph[v]) {
+        Id source = component[graph.get_source(edge)];
+        Id target = component[graph.get_target(edge)];
+        if (source != target) {
+          size_t position = next[target]++;
+          sources[position] = source;
+          if constexpr (weighted) {
+            weights[position] = weight(edge);
+          }
+        }
+      }
+    }
+  }
+
+  // Second pass: targets grouped by source, each group sorted by target
+  std::vector<Id> targets(num_arcs);
+  std::vector<Distance> sorted_weights(weighted ? num_arcs : 0);
+  {
+    std::vector<size_t> next(by_source.begin(), by_source.end() - 1);
+    for (size_t target = 0; target < num_components; ++target) {
+      for (size_t i = by_target[target]; i < by_target[target + 1]; ++i) {
+        size_t position = next[sources[i]]++;
+        targets[position] = static_cast<Id>(target);
+        if constexpr (weighted) {
+          sorted_weights[position] = weights[i];
+        }
+      }
+    }
+  }
+  sources = {};
+  weights = {};
+
+  // Merge of adjacent duplicates, compacting the arrays in place
+  WeightedCondensation<Id, Distance> result;
+  std::vector<size_t> offsets(num_components + 1, 0);
+  size_t size = 0;
+  for (size_t source = 0; source < num_components; ++source) {
+    size_t first = size;
+    for (size_t i = by_source[source]; i < by_source[source + 1]; ++i) {
+      if (size > first && targets[size - 1] == targets[i]) {
+        ++result.multiplicity.back();
+        if constexpr (weighted) {
+          sorted_weights[size - 1] =
+              std::min(sorted_weights[size - 1], sorted_weights[i]);
+        }
+      } else {
+        targets[size] = targets[i];
+        if constexpr (weighted) {
+          sorted_weights[size] = sorted_weights[i];
+        }
+        result.multiplicity.push_back(1);
+        ++size;
+      }
+    }
+    offsets[source + 1] = size;
+  }
+  targets.resize(size);
+  targets.shrink_to_fit();
+  if constexpr (weighted) {
+    sorted_weights.resize(size);
+    sorted_weights.shrink_to_fit();
+    result.min_weight = std::move(sorted_weights);
+  }
+
+  result.graph =
+      CompressedSparseRow<Id>(std::move(offsets), std::move(targets));
+  return result;
+}
+} // namespace detail::condensation
+
+template <concepts::Graph G>
+Condensation<Vertex<G>> condensation(const G &graph,
+                                     const std::vector<Vertex<G>> &component,
+                                     size_t num_components) {
+  auto no_weight = [](const Edge<G> &) { return false; };
+  auto condensed = detail::condensation::build<false, bool>(
+      graph, component, num_components, no_weight);
+  return {std::move(condensed.graph), std::move(condensed.multiplicity)};
+}
+
+template <concepts::Graph G>
+Condensation<Vertex<G>>
+condensation(const G &graph, const SCCComponents<Vertex<G>> &components) {
+  return condensation(graph, components.component, components.sizes.size());
+}
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+WeightedCondensation<Vertex<G>, Distance>
+weighted_condensation(const G &graph, const std::vector<Vertex<G>> &component,
+                      size_t num_components, Weight weight) {
+  return detail::condensation::build<true, Distance>(graph, component,
+                                                     num_components, weight);
+}
+
+} // namespace graphxx::algorithms
@@ -0,0 +1,150 @@
+/**
+ * @file This file is the header implementation of the parallel connected components algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp"  // make_csr
+#include "algorithms/connected_components.hpp" // connected_components
+#include "base.hpp"                            // Vertex
+#include "graph_concepts.hpp"                  // Graph
+#include "utils/parallel_utils.hpp"            // parallel_for
+#include "utils/union_find.hpp"                // ConcurrentUnionFind
+
+#include <algorithm> // std::sort
+#include <cstdint>   // size_t
+#include <random>    // std::mt19937
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::connected_components {
+// Number of neighbours of every vertex processed before looking for the giant
+// component
+constexpr size_t NEIGHBOUR_ROUNDS = 2;
+// Number of vertices sampled to find the giant component
+constexpr size_t NUM_SAMPLES = 1024;
+
+template <concepts::Identifier Id>
+Id most_frequent_label(utils::ConcurrentUnionFind<Id> &sets) {
+  std::mt19937 generator(sets.size());
+  std::uniform_int_distribution<size_t> pick(0, sets.size() - 1);
+
+  std::vector<Id> samples(NUM_SAMPLES);
+  for (auto &sample : samples) {
+    sample = sets.find(static_cast<Id>(pick(generator)));
+  }
+  std::sort(samples.begin(), samples.end());
+
+  Id best = samples[0];
+  size_t best_count = 0;
+  for (size_t first = 0; first < samples.size();) {
+    size_t last = first;
+    while (last < samples.size() && samples[last] == samples[first]) {
+      ++last;
+    }
+    if (last - first > best_count) {
+      best = samples[first];
+      best_count = last - first;
+    }
+    first = last;
+  }
+
+  return best;
+}
+
+// Unites every vertex outside of the giant component with its neighbours,
+// starting from the given one
+template <concepts::Identifier Id>
+void link_outside(const CompressedSparseRow<Id> &csr,
+                  utils::ConcurrentUnionFind<Id> &sets, Id giant, size_t skip,
+                  size_t num_threads) {
+  utils::parallel_for(
+      size_t{0}, csr.num_vertices(),
+      [&](size_t index) {
+        auto vertex = static_cast<Id>(index);
+        if (sets.find(vertex) == giant) {
+          return;
+        }
+        auto neighbours = csr[vertex];
+        for (size_t i = skip; i < neighbours.size(); ++i) {
+          sets.unite(vertex, neighbours[i]);
+        }
+      },
+      num_threads);
+}
+} // namespace detail::connected_components
+
+template <concepts::Graph G>
+std::vector<Vertex<G>> connected_components(const G &graph,
+                                            size_t num_threads) {
+  using Id = Vertex<G>;
+  using detail::connected_components::NEIGHBOUR_ROUNDS;
+
+  size_t size = graph.num_vertices();
+  if (size == 0) {
+    return {};
+  }
+
+  auto csr = make_csr(graph);
+  utils::ConcurrentUnionFind<Id> sets(size);
+
+  for (size_t round = 0; round < NEIGHBOUR_ROUNDS; ++round) {
+    utils::parallel_for(
+        size_t{0}, size,
+        [&](size_t index) {
+          auto vertex = static_cast<Id>(index);
+          if (csr.degree(vertex) > round) {
+            sets.unite(vertex, csr[vertex][round]);
+          }
+        },
+        num_threads);
+  }
+
+  Id giant = detail::connected_components::most_frequent_label(sets);
+
+  detail::connected_components::link_outside(csr, sets, giant,
+                                             NEIGHBOUR_ROUNDS, num_threads);
+  if constexpr (G::DIRECTEDNESS == Directedness::DIRECTED) {
+    detail::connected_components::link_outside(make_transposed_csr(graph), sets,
+                                               giant, 0, num_threads);
+  }
+
+  std::vector<Id> labels(size);
+  utils::parallel_for(
+      size_t{0}, size,
+      [&](size_t vertex) {
+        labels[vertex] = sets.find(static_cast<Id>(vertex));
+      },
+      num_threads);
+
+  return labels;
+}
+
+} // namespace graphxx::algorithms
@@ -0,0 +1,113 @@
+/**
+ * @file This file is the header implementation of the shortest and longest paths algorithms for directed acyclic graphs
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "algorithms/dag_paths.hpp"        // dag_shortest_paths
+#include "algorithms/dijkstra.hpp"         // DijkstraNode
+#include "algorithms/topological_sort.hpp" // topological_sort
+#include "base.hpp"                        // Vertex, Edge
+#include "graph_concepts.hpp"              // Graph
+#include "utils/numeric_utils.hpp"         // sum_will_overflow
+
+#include <algorithm>  // std::find
+#include <functional> // std::less, std::greater
+#include <limits>     // std::numeric_limits
+#include <vector>     // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::dag_paths {
+// Relaxes the out edges of the vertices reachable from the source in
+// topological order, keeping the best distance according to better
+template <concepts::Graph G, typename Weight, typename Distance,
+          typename Better>
+std::vector<DijkstraNode<Vertex<G>, Distance>>
+relax(const G &graph, Vertex<G> source, Weight &weight, Distance unreached,
+      Better better) {
+  using NodeType = DijkstraNode<Vertex<G>, Distance>;
+  std::vector<NodeType> distance_tree{
+      graph.num_vertices(),
+      NodeType{.distance = unreached, .parent = INVALID_VERTEX<G>}};
+
+  // The distance of the unreached vertices may be a valid one, e.g. for
+  // unsigned longest paths
+  std::vector<bool> reached(graph.num_vertices(), false);
+  auto order = algorithms::topological_sort(graph);
+  distance_tree[source].distance = 0;
+  reached[source] = true;
+
+  // Vertices before the source in topological order are not reachable
+  for (auto it = std::find(order.begin(), order.end(), source);
+       it != order.end(); ++it) {
+    auto u = *it;
+    if (!reached[u]) {
+      continue;
+    }
+
+    for (auto &&edge : graph[u]) {
+      auto v = graph.get_target(edge);
+      Distance edge_weight = weight(edge);
+
+      if (utils::sum_will_overflow(distance_tree[u].distance, edge_weight)) {
+        continue;
+      }
+
+      Distance alternative_distance = distance_tree[u].distance + edge_weight;
+      if (!reached[v] ||
+          better(alternative_distance, distance_tree[v].distance)) {
+        distance_tree[v].distance = alternative_distance;
+        distance_tree[v].parent = u;
+        reached[v] = true;
+      }
+    }
+  }
+
+  return distance_tree;
+}
+} // namespace detail::dag_paths
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+std::vector<DijkstraNode<Vertex<G>, Distance>>
+dag_shortest_paths(const G &graph, Vertex<G> source, Weight weight) {
+  return detail::dag_paths::relax(graph, source, weight,
+                                  std::numeric_limits<Distance>::max(),
+                                  std::less<Distance>{});
+}
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+std::vector<DijkstraNode<Vertex<G>, Distance>>
+dag_longest_paths(const G &graph, Vertex<G> source, Weight weight) {
+  return detail::dag_paths::relax(graph, source, weight,
+                                  std::numeric_limits<Distance>::lowest(),
+                                  std::greater<Distance>{});
+}
+
+} // namespace graphxx::algorithms
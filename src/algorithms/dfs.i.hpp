@@ -31,58 +31,154 @@
  */
 
 #include "algorithms/dfs.hpp"  // dfs
-#include "algorithms_base.hpp" // VertexStatus
+#include "algorithms_base.hpp" // VertexStatus, Visitor
 #include "base.hpp"            // Vertex
 #include "graph_concepts.hpp"  // Graph
 
-#include <functional> // std::function
-#include <vector>     // std::vector
+#include <concepts> // std::invocable
+#include <limits>   // std::numeric_limits
+#include <vector>   // std::vector
 
 namespace graphxx::algorithms {
 
 namespace detail::dfs {
 template <concepts::Graph G>
-void visit_rec(const G &graph, Vertex<G> vertex,
-               const std::function<void(Vertex<G>)> &callback, int &time,
-               std::vector<DfsNode<Vertex<G>>> &distance_tree) {
-  callback(vertex);
+std::vector<DfsNode<Vertex<G>>> make_distance_tree(const G &graph) {
+  using NodeType = DfsNode<Vertex<G>>;
+  constexpr auto unset_time = std::numeric_limits<Vertex<G>>::max();
+  return std::vector<NodeType>(graph.num_vertices(),
+                               NodeType{.status = VertexStatus::READY,
+                                        .parent = INVALID_VERTEX<G>,
+                                        .discovery_time = unset_time,
+                                        .finishing_time = unset_time});
+}
+} // namespace detail::dfs
+
+template <concepts::Graph G, concepts::Visitor<G> Visitor>
+bool depth_first_visit(const G &graph, Vertex<G> source, Visitor &&visitor,
+                       std::vector<DfsNode<Vertex<G>>> &distance_tree,
+                       Vertex<G> &time, DfsStack<G> &stack) {
+  stack.clear();
+
+  // Both lambdas return false if the visit has to stop
+  auto finish = [&](Vertex<G> vertex) {
+    distance_tree[vertex].status = VertexStatus::PROCESSED;
+    distance_tree[vertex].finishing_time = ++time;
+    return visitor.finish_vertex(vertex) != VisitorAction::STOP;
+  };
+
+  auto discover = [&](Vertex<G> vertex) {
+    distance_tree[vertex].status = VertexStatus::WAITING;
+    distance_tree[vertex].discovery_time = ++time;
+
+    VisitorAction action = visitor.discover_vertex(vertex);
+    if (action == VisitorAction::STOP) {
+      return false;
+    }
+    if (action == VisitorAction::SKIP) {
+      return finish(vertex);
+    }
 
-  distance_tree[vertex].status = VertexStatus::WAITING;
-  distance_tree[vertex].discovery_time = ++time;
+    auto &&edges = graph[vertex];
+    stack.push_back({.vertex = vertex,
+                     .current = edges.begin(),
+                     .end = edges.end()});
+    return true;
+  };
+
+  if (!discover(source)) {
+    return false;
+  }
+
+  while (!stack.empty()) {
+    DfsFrame<G> &frame = stack.back();
+
+    if (frame.current == frame.end) {
+      Vertex<G> vertex = frame.vertex;
+      stack.pop_back();
+      if (!finish(vertex)) {
+        return false;
+      }
+      continue;
+    }
+
+    Vertex<G> vertex = frame.vertex;
+    auto &&edge = *frame.current;
+    ++frame.current;
+
+    VisitorAction action = visitor.examine_edge(edge);
+    if (action == VisitorAction::STOP) {
+      return false;
+    }
+    if (action == VisitorAction::SKIP) {
+      continue;
+    }
 
-  for (auto&& edge : graph[vertex]) {
     Vertex<G> adjacent = graph.get_target(edge);
 
     if (distance_tree[adjacent].status == VertexStatus::READY) {
+      action = visitor.tree_edge(edge);
+      if (action == VisitorAction::STOP) {
+        return false;
+      }
+      if (action == VisitorAction::SKIP) {
+        continue;
+      }
+
+      // `frame` may be invalidated from here on, since discover pushes on
+      // the stack
       distance_tree[adjacent].parent = vertex;
-      visit_rec(graph, adjacent, callback, time, distance_tree);
+      if (!discover(adjacent)) {
+        return false;
+      }
     }
   }
 
-  distance_tree[vertex].status = VertexStatus::PROCESSED;
-  distance_tree[vertex].finishing_time = ++time;
+  return true;
 }
-} // namespace detail::dfs
 
 template <concepts::Graph G>
 std::vector<DfsNode<Vertex<G>>> dfs(const G &graph, Vertex<G> source) {
-  return dfs(graph, source, [](Vertex<G>) {});
+  return dfs(graph, source, DefaultVisitor{});
 }
 
-template <concepts::Graph G>
-std::vector<DfsNode<Vertex<G>>>
-dfs(const G &graph, Vertex<G> source,
-    const std::function<void(Vertex<G>)> &callback) {
+template <concepts::Graph G, std::invocable<Vertex<G>> Callback>
+std::vector<DfsNode<Vertex<G>>> dfs(const G &graph, Vertex<G> source,
+                                    Callback &&callback) {
+  return dfs(graph, source, detail::CallbackVisitor<Callback>{callback});
+}
 
-  using NodeType = DfsNode<Vertex<G>>;
-  std::vector<NodeType> distance_tree(graph.num_vertices(), NodeType{.status = VertexStatus::READY,
-                                     .parent = INVALID_VERTEX<G>,
-                                     .discovery_time = -1,
-                                     .finishing_time = -1});
+template <concepts::Graph G, concepts::Visitor<G> Visitor>
+std::vector<DfsNode<Vertex<G>>> dfs(const G &graph, Vertex<G> source,
+                                    Visitor &&visitor) {
+  auto distance_tree = detail::dfs::make_distance_tree(graph);
+  DfsStack<G> stack;
+  Vertex<G> time = 0;
+
+  depth_first_visit(graph, source, visitor, distance_tree, time, stack);
+
+  return distance_tree;
+}
+
+template <concepts::Graph G>
+std::vector<DfsNode<Vertex<G>>> dfs_forest(const G &graph) {
+  return dfs_forest(graph, DefaultVisitor{});
+}
 
-  int time = 0;
+template <concepts::Graph G, concepts::Visitor<G> Visitor>
+std::vector<DfsNode<Vertex<G>>> dfs_forest(const G &graph, Visitor &&visitor) {
+  auto distance_tree = detail::dfs::make_distance_tree(graph);
+  DfsStack<G> stack;
+  Vertex<G> time = 0;
 
-  detail::dfs::visit_rec(graph, source, callback, time, distance_tree);
+  for (Vertex<G> root = 0; root < graph.num_vertices(); ++root) {
+    if (distance_tree[root].status != VertexStatus::READY) {
+      continue;
+    }
+    if (!depth_first_visit(graph, root, visitor, distance_tree, time, stack)) {
+      break;
+    }
+  }
 
   return distance_tree;
 }
@@ -0,0 +1,176 @@
+/**
+ * @file This file is the header implementation of the diameter and eccentricity algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // make_symmetric_csr
+#include "algorithms/diameter.hpp"            // EccentricityBounds
+#include "graph_concepts.hpp"                 // Graph, Identifier
+
+#include <algorithm> // std::max, std::min
+#include <cstdint>   // size_t
+#include <limits>    // std::numeric_limits
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::diameter {
+constexpr size_t UNBOUNDED = std::numeric_limits<size_t>::max();
+
+// Breadth first search reusing its buffers across sweeps. The queue keeps the
+// vertices reached by the last sweep, so only those are reset
+template <concepts::Identifier Id> class Sweep {
+public:
+  explicit Sweep(size_t size) : _distance(size, UNBOUNDED) {
+    _queue.reserve(size);
+  }
+
+  // Returns the eccentricity of the source
+  size_t run(const CompressedSparseRow<Id> &symmetric, Id source) {
+    for (auto vertex : _queue) {
+      _distance[vertex] = UNBOUNDED;
+    }
+    _queue.clear();
+
+    _distance[source] = 0;
+    _queue.push_back(source);
+    for (size_t head = 0; head < _queue.size(); ++head) {
+      Id vertex = _queue[head];
+      for (auto neighbour : symmetric[vertex]) {
+        if (_distance[neighbour] == UNBOUNDED) {
+          _distance[neighbour] = _distance[vertex] + 1;
+          _queue.push_back(neighbour);
+        }
+      }
+    }
+    return _distance[_queue.back()];
+  }
+
+  const std::vector<Id> &reached() const { return _queue; }
+  size_t distance(Id vertex) const { return _distance[vertex]; }
+
+private:
+  std::vector<size_t> _distance;
+  std::vector<Id> _queue;
+};
+
+// Bounding eccentricities when diameter_only is false, otherwise bounding
+// diameter, which also drops the vertices that cannot raise the diameter
+template <concepts::Identifier Id>
+EccentricityBounds bound(const CompressedSparseRow<Id> &symmetric,
+                         size_t max_sweeps, bool diameter_only) {
+  size_t size = symmetric.num_vertices();
+  EccentricityBounds bounds{std::vector<size_t>(size, 0),
+                            std::vector<size_t>(size, UNBOUNDED), 0};
+  auto &lower = bounds.lower;
+  auto &upper = bounds.upper;
+
+  std::vector<Id> candidates(size);
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    candidates[vertex] = static_cast<Id>(vertex);
+  }
+  size_t diameter_lower = 0;
+  bool pick_upper = true;
+  Sweep<Id> sweep(size);
+
+  while (!candidates.empty() && bounds.num_sweeps < max_sweeps) {
+    // Alternate between the largest upper and the smallest lower bound
+    auto key = [&](Id vertex) {
+      return pick_upper ? upper[vertex] : lower[vertex];
+    };
+    Id source = candidates.front();
+    for (auto vertex : candidates) {
+      bool better = pick_upper ? key(vertex) > key(source)
+                               : key(vertex) < key(source);
+      if (better || (key(vertex) == key(source) &&
+                     symmetric.degree(vertex) > symmetric.degree(source))) {
+        source = vertex;
+      }
+    }
+    pick_upper = !pick_upper;
+
+    size_t eccentricity = sweep.run(symmetric, source);
+    ++bounds.num_sweeps;
+    for (auto vertex : sweep.reached()) {
+      size_t distance = sweep.distance(vertex);
+      lower[vertex] = std::max(
+          {lower[vertex], eccentricity - distance, distance});
+      upper[vertex] = std::min(upper[vertex], eccentricity + distance);
+      diameter_lower = std::max(diameter_lower, lower[vertex]);
+    }
+
+    std::erase_if(candidates, [&](Id vertex) {
+      return lower[vertex] == upper[vertex] ||
+             (diameter_only && upper[vertex] <= diameter_lower);
+    });
+  }
+
+  return bounds;
+}
+} // namespace detail::diameter
+
+template <concepts::Identifier Id>
+EccentricityBounds eccentricity_bounds(const CompressedSparseRow<Id> &symmetric,
+                                       size_t max_sweeps) {
+  return detail::diameter::bound(symmetric, max_sweeps, false);
+}
+
+template <concepts::Graph G>
+EccentricityBounds eccentricity_bounds(const G &graph, size_t max_sweeps) {
+  return eccentricity_bounds(make_symmetric_csr(graph), max_sweeps);
+}
+
+template <concepts::Identifier Id>
+std::vector<size_t> eccentricities(const CompressedSparseRow<Id> &symmetric) {
+  return eccentricity_bounds(symmetric).lower;
+}
+
+template <concepts::Graph G>
+std::vector<size_t> eccentricities(const G &graph) {
+  return eccentricities(make_symmetric_csr(graph));
+}
+
+template <concepts::Identifier Id>
+size_t diameter(const CompressedSparseRow<Id> &symmetric) {
+  auto bounds = detail::diameter::bound(
+      symmetric, std::numeric_limits<size_t>::max(), true);
+  size_t result = 0;
+  for (auto lower : bounds.lower) {
+    result = std::max(result, lower);
+  }
+  return result;
+}
+
+template <concepts::Graph G> size_t diameter(const G &graph) {
+  return diameter(make_symmetric_csr(graph));
+}
+
+} // namespace graphxx::algorithms
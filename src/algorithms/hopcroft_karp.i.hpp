@@ -0,0 +1,215 @@
+/**
+ * @file This file is the header implementation of the Hopcroft-Karp algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // make_csr
+#include "algorithms/hopcroft_karp.hpp"       // hopcroft_karp
+#include "base.hpp"                           // Vertex, INVALID_VERTEX
+#include "graph_concepts.hpp"                 // Graph
+#include "utils/parallel_utils.hpp"           // parallel_for
+
+#include <atomic>  // std::atomic_ref
+#include <cstdint> // size_t
+#include <limits>  // std::numeric_limits
+#include <vector>  // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::hopcroft_karp {
+constexpr size_t INFINITE_DISTANCE = std::numeric_limits<size_t>::max();
+
+// Every left vertex claims its first free right neighbour, so each right
+// vertex is taken by at most one left vertex
+template <concepts::Identifier Id>
+void greedy_matching(const CompressedSparseRow<Id> &csr,
+                     const std::vector<bool> &is_left, std::vector<Id> &mate,
+                     size_t num_threads) {
+  constexpr Id NONE = std::numeric_limits<Id>::max();
+
+  utils::parallel_for(
+      size_t{0}, csr.num_vertices(),
+      [&](size_t vertex) {
+        if (!is_left[vertex]) {
+          return;
+        }
+        for (Id neighbour : csr[static_cast<Id>(vertex)]) {
+          if (is_left[neighbour]) {
+            continue;
+          }
+          Id expected = NONE;
+          if (std::atomic_ref<Id>(mate[neighbour])
+                  .compare_exchange_strong(expected, static_cast<Id>(vertex),
+                                           std::memory_order_relaxed)) {
+            mate[vertex] = neighbour;
+            return;
+          }
+        }
+      },
+      num_threads);
+}
+
+// Layers of the shortest alternating paths from the free left vertices,
+// returning the length of the shortest augmenting path
+template <concepts::Identifier Id>
+size_t build_layers(const CompressedSparseRow<Id> &csr,
+                    const std::vector<bool> &is_left,
+                    const std::vector<Id> &mate, std::vector<size_t> &distance,
+                    std::vector<Id> &queue) {
+  constexpr Id NONE = std::numeric_limits<Id>::max();
+
+  queue.clear();
+  for (Id vertex = 0; vertex < csr.num_vertices(); ++vertex) {
+    if (is_left[vertex] && mate[vertex] == NONE) {
+      distance[vertex] = 0;
+      queue.push_back(vertex);
+    } else {
+      distance[vertex] = INFINITE_DISTANCE;
+    }
+  }
+
+  size_t limit = INFINITE_DISTANCE;
+  for (size_t i = 0; i < queue.size(); ++i) {
+    Id vertex = queue[i];
+    if (distance[vertex] + 1 >= limit) {
+      break;
+    }
+    for (Id neighbour : csr[vertex]) {
+      if (is_left[neighbour]) {
+        continue;
+      }
+      Id next = mate[neighbour];
+      if (next == NONE) {
+        limit = distance[vertex] + 1;
+      } else if (distance[next] == INFINITE_DISTANCE) {
+        distance[next] = distance[vertex] + 1;
+        queue.push_back(next);
+      }
+    }
+  }
+
+  return limit;
+}
+} // namespace detail::hopcroft_karp
+
+template <concepts::Graph G>
+std::vector<Vertex<G>>
+hopcroft_karp(const G &graph, const std::vector<bool> &is_left,
+              bool greedy_initialization, size_t num_threads) {
+  using Id = Vertex<G>;
+  using detail::hopcroft_karp::INFINITE_DISTANCE;
+  constexpr Id NONE = INVALID_VERTEX<G>;
+
+  auto csr = make_csr(graph);
+  size_t size = csr.num_vertices();
+
+  std::vector<Id> mate(size, NONE);
+  if (greedy_initialization) {
+    detail::hopcroft_karp::greedy_matching(csr, is_left, mate, num_threads);
+  }
+
+  std::vector<size_t> distance(size);
+  std::vector<size_t> current(size);
+  std::vector<Id> via(size);
+  std::vector<Id> queue;
+  std::vector<Id> stack;
+
+  while (true) {
+    size_t limit = detail::hopcroft_karp::build_layers(csr, is_left, mate,
+                                                       distance, queue);
+    if (limit == INFINITE_DISTANCE) {
+      break;
+    }
+
+    for (Id vertex = 0; vertex < size; ++vertex) {
+      current[vertex] = csr.offsets()[vertex];
+    }
+
+    // Vertex disjoint augmenting paths along the layers: a left vertex that
+    // leads nowhere is removed from the layers
+    for (Id root = 0; root < size; ++root) {
+      if (!is_left[root] || mate[root] != NONE) {
+        continue;
+      }
+
+      stack.assign(1, root);
+      while (!stack.empty()) {
+        Id vertex = stack.back();
+        size_t &position = current[vertex];
+        bool advanced = false;
+
+        for (; position < csr.offsets()[vertex + 1]; ++position) {
+          Id neighbour = csr.targets()[position];
+          if (is_left[neighbour]) {
+            continue;
+          }
+          Id next = mate[neighbour];
+          if (next == NONE && distance[vertex] + 1 == limit) {
+            via[vertex] = neighbour;
+            for (Id left : stack) {
+              mate[left] = via[left];
+              mate[via[left]] = left;
+            }
+            stack.clear();
+            advanced = true;
+            break;
+          }
+          if (next != NONE && distance[next] == distance[vertex] + 1) {
+            via[vertex] = neighbour;
+            ++position;
+            stack.push_back(next);
+            advanced = true;
+            break;
+          }
+        }
+
+        if (!advanced) {
+          distance[vertex] = INFINITE_DISTANCE;
+          stack.pop_back();
+        }
+      }
+    }
+  }
+
+  return mate;
+}
+
+template <concepts::Graph G, std::predicate<Vertex<G>> Side>
+std::vector<Vertex<G>> hopcroft_karp(const G &graph, Side is_left,
+                                     bool greedy_initialization,
+                                     size_t num_threads) {
+  std::vector<bool> sides(graph.num_vertices());
+  for (Vertex<G> vertex = 0; vertex < graph.num_vertices(); ++vertex) {
+    sides[vertex] = is_left(vertex);
+  }
+  return hopcroft_karp(graph, sides, greedy_initialization, num_threads);
+}
+
+} // namespace graphxx::algorithms
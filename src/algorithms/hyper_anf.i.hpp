@@ -0,0 +1,204 @@
+/**
+ * @file This file is the header implementation of the HyperANF algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "algorithms/hyper_anf.hpp" // NeighbourhoodFunction
+#include "base.hpp"                 // Vertex
+#include "exceptions.hpp"           // InvariantViolationException
+#include "graph_concepts.hpp"       // Graph
+#include "utils/parallel_utils.hpp" // parallel_for_chunks
+#include "utils/simd_utils.hpp"     // max_into
+
+#include <algorithm> // std::copy_n, std::fill, std::find
+#include <array>     // std::array
+#include <bit>       // std::countl_zero
+#include <cmath>     // std::log
+#include <cstdint>   // size_t, uint8_t, uint64_t
+#include <numeric>   // std::accumulate
+#include <span>      // std::span
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::hyper_anf {
+// Number of vertices in every chunk, each one with its own partial sum
+constexpr size_t GRAIN = 1024;
+constexpr size_t MIN_LOG2_REGISTERS = 4;
+constexpr size_t MAX_LOG2_REGISTERS = 16;
+
+// 2^-r for every value r a register can take
+constexpr auto INVERSE_POWERS = [] {
+  std::array<double, 65> powers{};
+  double power = 1;
+  for (auto &value : powers) {
+    value = power;
+    power /= 2;
+  }
+  return powers;
+}();
+
+// SplitMix64 finalizer
+inline uint64_t hash(uint64_t value) {
+  value += 0x9E3779B97F4A7C15ULL;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  return value ^ (value >> 31);
+}
+
+// HyperLogLog estimate with the linear counting correction for small sets
+inline double estimate(std::span<const uint8_t> registers) {
+  double size = static_cast<double>(registers.size());
+  double sum = 0;
+  size_t zeros = 0;
+  for (auto value : registers) {
+    sum += INVERSE_POWERS[value];
+    zeros += value == 0;
+  }
+  double alpha = 0.7213 / (1 + 1.079 / size);
+  double raw = alpha * size * size / sum;
+  if (raw <= 2.5 * size && zeros > 0) {
+    return size * std::log(size / static_cast<double>(zeros));
+  }
+  return raw;
+}
+} // namespace detail::hyper_anf
+
+template <concepts::Graph G>
+NeighbourhoodFunction hyper_anf(const G &graph, size_t log2_registers,
+                                size_t max_iterations, unsigned seed,
+                                size_t num_threads) {
+  using detail::hyper_anf::estimate;
+  using detail::hyper_anf::GRAIN;
+  using detail::hyper_anf::MAX_LOG2_REGISTERS;
+  using detail::hyper_anf::MIN_LOG2_REGISTERS;
+  if (log2_registers < MIN_LOG2_REGISTERS ||
+      log2_registers > MAX_LOG2_REGISTERS) {
+    throw exceptions::InvariantViolationException(
+        "number of registers out of range");
+  }
+
+  size_t size = graph.num_vertices();
+  size_t width = size_t{1} << log2_registers;
+  std::vector<uint8_t> current(size * width, 0);
+  std::vector<uint8_t> next(size * width);
+  auto registers_of = [&](std::vector<uint8_t> &counters, size_t vertex) {
+    return std::span<uint8_t>(counters.data() + vertex * width, width);
+  };
+
+  // A ball of radius zero holds the vertex alone: the first bits of its hash
+  // select a register, which stores the position of the first one bit among
+  // the others
+  NeighbourhoodFunction result{{},
+                               std::vector<double>(size),
+                               std::vector<double>(size, 0)};
+  uint64_t salt = detail::hyper_anf::hash(seed);
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    uint64_t bits = detail::hyper_anf::hash(vertex ^ salt);
+    uint64_t rest = (bits << log2_registers) |
+                    (uint64_t{1} << (log2_registers - 1));
+    current[vertex * width + (bits >> (64 - log2_registers))] =
+        static_cast<uint8_t>(std::countl_zero(rest) + 1);
+    result.reachable[vertex] = estimate(registers_of(current, vertex));
+  }
+  result.estimates.push_back(std::accumulate(
+      result.reachable.begin(), result.reachable.end(), 0.0));
+
+  // Counters that changed in the last iteration, as bytes to be written
+  // concurrently
+  std::vector<uint8_t> changed(size, 1);
+  std::vector<uint8_t> next_changed(size);
+  size_t num_chunks = (size + GRAIN - 1) / GRAIN;
+  std::vector<double> chunk_growth(num_chunks);
+
+  for (size_t iteration = 1; iteration <= max_iterations; ++iteration) {
+    std::fill(chunk_growth.begin(), chunk_growth.end(), 0.0);
+    utils::parallel_for_chunks(
+        size_t{0}, size,
+        [&](size_t, size_t first, size_t last) {
+          double growth = 0;
+          for (size_t vertex = first; vertex < last; ++vertex) {
+            auto ball = registers_of(next, vertex);
+            std::copy_n(current.data() + vertex * width, width, ball.data());
+            bool grows = false;
+            for (auto &&edge : graph[static_cast<Vertex<G>>(vertex)]) {
+              auto neighbour = graph.get_target(edge);
+              if (changed[neighbour]) {
+                grows |= utils::max_into(ball, registers_of(current,
+                                                            neighbour));
+              }
+            }
+            next_changed[vertex] = grows;
+            if (grows) {
+              double reachable = estimate(ball);
+              double added = reachable - result.reachable[vertex];
+              result.sum_of_distances[vertex] +=
+                  static_cast<double>(iteration) * added;
+              result.reachable[vertex] = reachable;
+              growth += added;
+            }
+          }
+          chunk_growth[first / GRAIN] = growth;
+        },
+        num_threads, GRAIN);
+
+    current.swap(next);
+    changed.swap(next_changed);
+    if (std::find(changed.begin(), changed.end(), 1) == changed.end()) {
+      break;
+    }
+    result.estimates.push_back(
+        result.estimates.back() +
+        std::accumulate(chunk_growth.begin(), chunk_growth.end(), 0.0));
+  }
+
+  return result;
+}
+
+inline double effective_diameter(const std::vector<double> &estimates,
+                                 double fraction) {
+  if (estimates.empty()) {
+    return 0;
+  }
+  double target = fraction * estimates.back();
+  size_t steps = 0;
+  while (steps + 1 < estimates.size() && estimates[steps] < target) {
+    ++steps;
+  }
+  if (steps == 0) {
+    return 0;
+  }
+  double below = estimates[steps - 1];
+  double above = estimates[steps];
+  return static_cast<double>(steps - 1) +
+         (above > below ? (target - below) / (above - below) : 1);
+}
+
+} // namespace graphxx::algorithms
@@ -0,0 +1,125 @@
+/**
+ * @file This file is the header implementation of the incremental connectivity structure
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "algorithms/connected_components.hpp"     // connected_components
+#include "algorithms/incremental_connectivity.hpp" // IncrementalConnectivity
+#include "base.hpp"                                // Vertex, Edge
+#include "graph_concepts.hpp"                      // Graph
+#include "utils/parallel_utils.hpp"                // parallel_for_chunks
+#include "utils/tuple_utils.hpp"                   // get_elements_from_index
+
+#include <atomic>  // std::atomic
+#include <cstdint> // size_t
+#include <tuple>   // std::get
+#include <vector>  // std::vector
+
+namespace graphxx::algorithms {
+
+template <concepts::Graph G>
+IncrementalConnectivity<G>::IncrementalConnectivity(G &graph,
+                                                    size_t num_threads)
+    : _graph{graph}, _sets(graph.num_vertices()) {
+  auto labels = connected_components(graph, num_threads);
+  // Every label is the root of its set, so no vertex is walked twice
+  std::atomic<size_t> num_unions = 0;
+  utils::parallel_for_chunks(
+      size_t{0}, labels.size(),
+      [&](size_t, size_t first, size_t last) {
+        size_t unions = 0;
+        for (size_t vertex = first; vertex < last; ++vertex) {
+          unions += _sets.unite(static_cast<Vertex>(vertex), labels[vertex]);
+        }
+        num_unions += unions;
+      },
+      num_threads);
+  _num_unions = num_unions;
+}
+
+template <concepts::Graph G>
+void IncrementalConnectivity<G>::add_edge(Vertex source, Vertex target,
+                                          Attributes attributes) {
+  _graph.add_edge(source, target, attributes);
+  grow();
+  _num_unions += _sets.unite(source, target);
+}
+
+template <concepts::Graph G>
+void IncrementalConnectivity<G>::add_edges(const std::vector<Edge> &edges,
+                                           size_t num_threads) {
+  // The graph is not thread safe, only the unions run in parallel
+  for (auto &edge : edges) {
+    _graph.add_edge(std::get<0>(edge), std::get<1>(edge),
+                    utils::get_elements_from_index<2>(edge));
+  }
+  grow();
+
+  std::atomic<size_t> num_unions = 0;
+  utils::parallel_for_chunks(
+      size_t{0}, edges.size(),
+      [&](size_t, size_t first, size_t last) {
+        size_t unions = 0;
+        for (size_t i = first; i < last; ++i) {
+          unions += _sets.unite(std::get<0>(edges[i]), std::get<1>(edges[i]));
+        }
+        num_unions += unions;
+      },
+      num_threads);
+  _num_unions += num_unions;
+}
+
+template <concepts::Graph G>
+bool IncrementalConnectivity<G>::connected(Vertex lhs, Vertex rhs) {
+  if (lhs >= _sets.size() || rhs >= _sets.size()) {
+    return lhs == rhs;
+  }
+  return _sets.connected(lhs, rhs);
+}
+
+template <concepts::Graph G>
+typename IncrementalConnectivity<G>::Vertex
+IncrementalConnectivity<G>::component(Vertex vertex) {
+  if (vertex >= _sets.size()) {
+    return vertex;
+  }
+  return _sets.find(vertex);
+}
+
+template <concepts::Graph G>
+size_t IncrementalConnectivity<G>::num_components() const {
+  return _graph.num_vertices() - _num_unions;
+}
+
+template <concepts::Graph G> void IncrementalConnectivity<G>::grow() {
+  _sets.resize(_graph.num_vertices());
+}
+
+} // namespace graphxx::algorithms
@@ -0,0 +1,202 @@
+/**
+ * @file This file is the header implementation of the k-core decomposition algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // make_symmetric_csr
+#include "algorithms/k_core.hpp"              // core_numbers
+#include "graph_concepts.hpp"                 // Graph, Identifier
+#include "utils/parallel_utils.hpp"           // parallel_for, parallel_collect
+
+#include <algorithm> // std::min, std::max
+#include <atomic>    // std::atomic_ref
+#include <cstdint>   // size_t
+#include <limits>    // std::numeric_limits
+#include <utility>   // std::swap, std::move
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::k_core {
+// Number of vertices assigned to a thread at a time
+constexpr size_t GRAIN = 256;
+// Core number of the vertices not removed yet
+constexpr size_t UNKNOWN = std::numeric_limits<size_t>::max();
+
+// Vertices in the order they are removed by the bucket algorithm, which is
+// a smallest-last order, and their core numbers
+template <concepts::Identifier Id> struct Peeling {
+  std::vector<Id> order;
+  std::vector<size_t> core;
+};
+
+template <concepts::Identifier Id>
+Peeling<Id> peel(const CompressedSparseRow<Id> &symmetric) {
+  size_t size = symmetric.num_vertices();
+  std::vector<size_t> degree(size);
+  size_t max_degree = 0;
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    degree[vertex] = symmetric.degree(static_cast<Id>(vertex));
+    max_degree = std::max(max_degree, degree[vertex]);
+  }
+
+  // Counting sort of the vertices by degree
+  std::vector<size_t> bucket_start(max_degree + 2, 0);
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    ++bucket_start[degree[vertex] + 1];
+  }
+  for (size_t d = 0; d <= max_degree; ++d) {
+    bucket_start[d + 1] += bucket_start[d];
+  }
+  std::vector<Id> sorted(size);
+  std::vector<size_t> position(size);
+  {
+    std::vector<size_t> next(bucket_start.begin(), bucket_start.end() - 1);
+    for (size_t vertex = 0; vertex < size; ++vertex) {
+      position[vertex] = next[degree[vertex]]++;
+      sorted[position[vertex]] = static_cast<Id>(vertex);
+    }
+  }
+
+  // The degree of a vertex is final when it is reached, so it is its core
+  for (size_t i = 0; i < size; ++i) {
+    Id vertex = sorted[i];
+    for (auto neighbour : symmetric[vertex]) {
+      size_t d = degree[neighbour];
+      if (d > degree[vertex]) {
+        // Swap the neighbour with the first vertex of its bucket, then move
+        // the bucket boundary past it
+        size_t first = bucket_start[d];
+        Id other = sorted[first];
+        std::swap(sorted[first], sorted[position[neighbour]]);
+        position[other] = position[neighbour];
+        position[neighbour] = first;
+        ++bucket_start[d];
+        --degree[neighbour];
+      }
+    }
+  }
+
+  return {std::move(sorted), std::move(degree)};
+}
+} // namespace detail::k_core
+
+template <concepts::Identifier Id>
+std::vector<size_t> core_numbers(const CompressedSparseRow<Id> &symmetric) {
+  return detail::k_core::peel(symmetric).core;
+}
+
+template <concepts::Graph G> std::vector<size_t> core_numbers(const G &graph) {
+  return core_numbers(make_symmetric_csr(graph));
+}
+
+template <concepts::Identifier Id>
+std::vector<size_t>
+parallel_core_numbers(const CompressedSparseRow<Id> &symmetric,
+                      size_t num_threads) {
+  using detail::k_core::GRAIN;
+  using detail::k_core::UNKNOWN;
+
+  size_t size = symmetric.num_vertices();
+  std::vector<size_t> degree(size);
+  std::vector<size_t> core(size, UNKNOWN);
+  utils::parallel_for(
+      size_t{0}, size,
+      [&](size_t vertex) {
+        degree[vertex] = symmetric.degree(static_cast<Id>(vertex));
+      },
+      num_threads);
+
+  std::vector<Id> remaining(size);
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    remaining[vertex] = static_cast<Id>(vertex);
+  }
+
+  while (!remaining.empty()) {
+    size_t level = UNKNOWN;
+    for (auto vertex : remaining) {
+      level = std::min(level, degree[vertex]);
+    }
+
+    auto frontier = utils::parallel_collect<Id>(
+        size_t{0}, remaining.size(),
+        [&](size_t index, std::vector<Id> &output) {
+          if (degree[remaining[index]] == level) {
+            output.push_back(remaining[index]);
+          }
+        },
+        num_threads, GRAIN);
+
+    while (!frontier.empty()) {
+      // Removing the whole frontier first keeps its vertices from being
+      // decremented and collected again
+      for (auto vertex : frontier) {
+        core[vertex] = level;
+      }
+
+      frontier = utils::parallel_collect<Id>(
+          size_t{0}, frontier.size(),
+          [&](size_t index, std::vector<Id> &output) {
+            for (auto neighbour : symmetric[frontier[index]]) {
+              if (core[neighbour] != UNKNOWN) {
+                continue;
+              }
+              // Only the decrement bringing the degree to the level collects
+              // the neighbour, so every vertex is collected once
+              if (std::atomic_ref<size_t>(degree[neighbour])
+                      .fetch_sub(1, std::memory_order_relaxed) == level + 1) {
+                output.push_back(neighbour);
+              }
+            }
+          },
+          num_threads, GRAIN);
+    }
+
+    remaining = utils::parallel_collect<Id>(
+        size_t{0}, remaining.size(),
+        [&](size_t index, std::vector<Id> &output) {
+          if (core[remaining[index]] == UNKNOWN) {
+            output.push_back(remaining[index]);
+          }
+        },
+        num_threads, GRAIN);
+  }
+
+  return core;
+}
+
+template <concepts::Graph G>
+std::vector<size_t> parallel_core_numbers(const G &graph,
+                                          size_t num_threads) {
+  return parallel_core_numbers(make_symmetric_csr(graph, num_threads),
+                               num_threads);
+}
+
+} // namespace graphxx::algorithms
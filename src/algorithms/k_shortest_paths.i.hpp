@@ -0,0 +1,224 @@
+/**
+ * @file This file is the header implementation of Yen's K shortest paths algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // make_csr
+#include "algorithms/k_shortest_paths.hpp"    // WeightedPath
+#include "base.hpp"                           // Vertex, Edge
+#include "exceptions.hpp"                     // InvariantViolationException
+#include "graph_concepts.hpp"                 // Graph, Identifier, Numeric
+#include "utils/indexed_heap.hpp"             // IndexedHeap
+#include "utils/numeric_utils.hpp"            // sum_will_overflow
+
+#include <algorithm> // std::equal, std::reverse
+#include <cstdint>   // size_t
+#include <limits>    // std::numeric_limits
+#include <map>       // std::map
+#include <utility>   // std::pair, std::move
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::k_shortest_paths {
+// Path with the positions of its edges in the compressed sparse row
+template <concepts::Identifier Id, concepts::Numeric Distance> struct Path {
+  std::vector<Id> vertices;
+  std::vector<size_t> edges;
+  Distance distance;
+};
+
+// Dijkstra search from a source to a target over a compressed sparse row
+// with a weight per entry, avoiding the vertices and edges removed since the
+// last call to restore. Stamps replace resetting the arrays between searches
+template <concepts::Identifier Id, concepts::Numeric Distance>
+class SpurSearch {
+public:
+  SpurSearch(const CompressedSparseRow<Id> &csr,
+             const std::vector<Distance> &weights)
+      : _csr{csr}, _weights{weights}, _distance(csr.num_vertices()),
+        _parent(csr.num_vertices()), _parent_edge(csr.num_vertices()),
+        _reached(csr.num_vertices(), 0),
+        _vertex_removed(csr.num_vertices(), 0),
+        _edge_removed(csr.num_edges(), 0), _heap(csr.num_vertices()) {}
+
+  // Puts back all the removed vertices and edges
+  void restore() { ++_epoch; }
+
+  void remove_vertex(Id vertex) { _vertex_removed[vertex] = _epoch; }
+
+  void remove_edge(size_t position) { _edge_removed[position] = _epoch; }
+
+  // Writes a shortest path, if the target is reachable
+  bool run(Id source, Id target, Path<Id, Distance> &path) {
+    ++_search;
+    _heap.clear();
+    _reached[source] = _search;
+    _distance[source] = 0;
+    _heap.push(source, 0);
+
+    while (!_heap.empty() && _heap.top() != target) {
+      auto vertex = static_cast<Id>(_heap.pop());
+      for (size_t position = _csr.offsets()[vertex];
+           position < _csr.offsets()[vertex + 1]; ++position) {
+        Id next = _csr.targets()[position];
+        if (_edge_removed[position] == _epoch ||
+            _vertex_removed[next] == _epoch ||
+            utils::sum_will_overflow(_distance[vertex], _weights[position])) {
+          continue;
+        }
+        Distance alternative = _distance[vertex] + _weights[position];
+        if (_reached[next] != _search) {
+          _reached[next] = _search;
+        } else if (!(alternative < _distance[next])) {
+          continue;
+        }
+        _distance[next] = alternative;
+        _parent[next] = vertex;
+        _parent_edge[next] = position;
+        _heap.push_or_decrease(next, alternative);
+      }
+    }
+    if (_heap.empty()) {
+      return false;
+    }
+
+    path.vertices.assign(1, target);
+    path.edges.clear();
+    path.distance = _distance[target];
+    for (Id vertex = target; vertex != source;) {
+      size_t position = _parent_edge[vertex];
+      path.edges.push_back(position);
+      vertex = _parent[vertex];
+      path.vertices.push_back(vertex);
+    }
+    std::reverse(path.vertices.begin(), path.vertices.end());
+    std::reverse(path.edges.begin(), path.edges.end());
+    return true;
+  }
+
+private:
+  const CompressedSparseRow<Id> &_csr;
+  const std::vector<Distance> &_weights;
+  std::vector<Distance> _distance;
+  std::vector<Id> _parent;
+  std::vector<size_t> _parent_edge;
+  std::vector<size_t> _reached;
+  std::vector<size_t> _vertex_removed;
+  std::vector<size_t> _edge_removed;
+  utils::IndexedHeap<Distance> _heap;
+  size_t _search = 0;
+  size_t _epoch = 1;
+};
+} // namespace detail::k_shortest_paths
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+std::vector<WeightedPath<Vertex<G>, Distance>>
+k_shortest_paths(const G &graph, Vertex<G> source, Vertex<G> target,
+                 size_t k, Weight weight) {
+  using Path = detail::k_shortest_paths::Path<Vertex<G>, Distance>;
+
+  auto csr = make_csr(graph);
+  std::vector<Distance> weights;
+  weights.reserve(csr.num_edges());
+  for (Vertex<G> vertex = 0; vertex < graph.num_vertices(); ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      Distance value = weight(edge);
+      if (value < 0) {
+        throw exceptions::InvariantViolationException(
+            "negative edge weight found");
+      }
+      weights.push_back(value);
+    }
+  }
+
+  std::vector<WeightedPath<Vertex<G>, Distance>> result;
+  if (k == 0) {
+    return result;
+  }
+  detail::k_shortest_paths::SpurSearch<Vertex<G>, Distance> search(csr,
+                                                                   weights);
+  std::vector<Path> found(1);
+  if (!search.run(source, target, found.front())) {
+    return result;
+  }
+
+  // Candidates by distance and vertices, which also discards duplicates
+  std::map<std::pair<Distance, std::vector<Vertex<G>>>, std::vector<size_t>>
+      candidates;
+  Path spur;
+  while (found.size() < k) {
+    const Path &last = found.back();
+    Distance root_distance = 0;
+    for (size_t i = 0; i + 1 < last.vertices.size(); ++i) {
+      search.restore();
+      for (const auto &path : found) {
+        if (path.vertices.size() > i + 1 &&
+            std::equal(last.vertices.begin(), last.vertices.begin() + i + 1,
+                       path.vertices.begin())) {
+          search.remove_edge(path.edges[i]);
+        }
+      }
+      for (size_t j = 0; j < i; ++j) {
+        search.remove_vertex(last.vertices[j]);
+      }
+
+      if (search.run(last.vertices[i], target, spur) &&
+          !utils::sum_will_overflow(root_distance, spur.distance)) {
+        std::vector<Vertex<G>> vertices(last.vertices.begin(),
+                                        last.vertices.begin() + i);
+        vertices.insert(vertices.end(), spur.vertices.begin(),
+                        spur.vertices.end());
+        std::vector<size_t> edges(last.edges.begin(),
+                                  last.edges.begin() + i);
+        edges.insert(edges.end(), spur.edges.begin(), spur.edges.end());
+        candidates.emplace(
+            std::pair{root_distance + spur.distance, std::move(vertices)},
+            std::move(edges));
+      }
+      root_distance += weights[last.edges[i]];
+    }
+
+    if (candidates.empty()) {
+      break;
+    }
+    auto best = candidates.extract(candidates.begin());
+    found.push_back(Path{std::move(best.key().second),
+                         std::move(best.mapped()), best.key().first});
+  }
+
+  result.reserve(found.size());
+  for (auto &path : found) {
+    result.push_back({std::move(path.vertices), path.distance});
+  }
+  return result;
+}
+
+} // namespace graphxx::algorithms
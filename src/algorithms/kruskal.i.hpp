@@ -30,13 +30,18 @@
  * @version v1.0
  */
 
-#include "algorithms/kruskal.hpp" // kruskal
-#include "base.hpp"               // Edge
-#include "graph_concepts.hpp"     // Graph
+#include "algorithms/kruskal.hpp"              // kruskal
+#include "algorithms/spanning_forest_base.hpp" // spanning_edges
+#include "base.hpp"                            // Edge
+#include "graph_concepts.hpp"                  // Graph
+#include "utils/parallel_utils.hpp"            // parallel_sort
 
-#include <cstdint> // size_t
-#include <tuple>   // std::tuple
-#include <vector>  // std::vector
+#include <algorithm> // std::sort, std::partition, std::nth_element
+#include <array>     // std::array
+#include <cstdint>   // size_t
+#include <tuple>     // std::tuple
+#include <utility>   // std::pair
+#include <vector>    // std::vector
 
 namespace graphxx::algorithms {
 
@@ -59,6 +64,131 @@ Id find_representative(std::vector<std::tuple<Id, size_t>> &ranked_sets,
 
   return root;
 }
+
+// Same as find_representative, but without compressing the path, so that
+// several threads can call it at the same time
+template <concepts::Identifier Id>
+Id find_root(const std::vector<std::tuple<Id, size_t>> &ranked_sets, Id id) {
+  while (id != std::get<0>(ranked_sets[id])) {
+    id = std::get<0>(ranked_sets[id]);
+  }
+  return id;
+}
+
+// Merges the clusters of the two vertices by rank, returning false if they
+// were already in the same cluster
+template <concepts::Identifier Id>
+bool unite(std::vector<std::tuple<Id, size_t>> &ranked_sets, Id source,
+           Id target) {
+  Id source_root = find_representative(ranked_sets, source);
+  Id target_root = find_representative(ranked_sets, target);
+
+  if (source_root == target_root) {
+    return false;
+  }
+
+  size_t source_set_rank = std::get<1>(ranked_sets[source_root]);
+  size_t target_set_rank = std::get<1>(ranked_sets[target_root]);
+
+  if (source_set_rank < target_set_rank) {
+    std::get<0>(ranked_sets[source_root]) = target_root;
+  } else {
+    std::get<0>(ranked_sets[target_root]) = source_root;
+  }
+
+  if (source_set_rank == target_set_rank) {
+    std::get<1>(ranked_sets[source_root])++;
+  }
+
+  return true;
+}
+
+// Sorting key of an edge: its weight and its position among the candidate
+// edges, which also breaks ties deterministically
+template <typename Distance> struct EdgeKey {
+  Distance weight;
+  size_t index;
+
+  bool operator<(const EdgeKey &other) const {
+    return weight < other.weight ||
+           (weight == other.weight && index < other.index);
+  }
+};
+
+template <concepts::Graph G, typename Distance> struct FilterKruskalState {
+  std::vector<EdgeKey<Distance>> keys;
+  std::vector<std::pair<Vertex<G>, Vertex<G>>> endpoints;
+  std::vector<std::tuple<Vertex<G>, size_t>> ranked_sets;
+  // Indices of the edges of the tree, in increasing weight order
+  std::vector<size_t> tree;
+  // Ranges with at most this number of edges are sorted and scanned
+  size_t threshold;
+  size_t num_threads;
+};
+
+template <concepts::Graph G, typename Distance>
+void filter_kruskal(FilterKruskalState<G, Distance> &state, size_t first,
+                    size_t last) {
+  size_t num_vertices = state.ranked_sets.size();
+  if (first == last || state.tree.size() + 1 >= num_vertices) {
+    return;
+  }
+
+  auto begin = state.keys.begin();
+
+  if (last - first <= state.threshold) {
+    utils::parallel_sort(begin + first, begin + last, std::less<>{},
+                         state.num_threads);
+    for (size_t i = first; i < last; ++i) {
+      auto [source, target] = state.endpoints[state.keys[i].index];
+      if (unite(state.ranked_sets, source, target)) {
+        state.tree.push_back(state.keys[i].index);
+        if (state.tree.size() + 1 == num_vertices) {
+          return;
+        }
+      }
+    }
+    return;
+  }
+
+  // The median of evenly spaced samples is neither the smallest nor the
+  // largest key, so both sides of the partition are never empty
+  constexpr size_t num_samples = 9;
+  std::array<EdgeKey<Distance>, num_samples> samples;
+  for (size_t i = 0; i < num_samples; ++i) {
+    samples[i] = state.keys[first + (last - first - 1) * i / (num_samples - 1)];
+  }
+  std::nth_element(samples.begin(), samples.begin() + num_samples / 2,
+                   samples.end());
+  EdgeKey<Distance> pivot = samples[num_samples / 2];
+
+  size_t middle =
+      std::partition(begin + first, begin + last,
+                     [&](const EdgeKey<Distance> &key) {
+                       return !(pivot < key);
+                     }) -
+      begin;
+
+  filter_kruskal(state, first, middle);
+  if (state.tree.size() + 1 >= num_vertices) {
+    return;
+  }
+
+  // Drop the heavy edges whose endpoints are already in the same tree
+  auto survivors = utils::parallel_collect<EdgeKey<Distance>>(
+      middle, last,
+      [&](size_t i, std::vector<EdgeKey<Distance>> &output) {
+        auto [source, target] = state.endpoints[state.keys[i].index];
+        if (find_root(state.ranked_sets, source) !=
+            find_root(state.ranked_sets, target)) {
+          output.push_back(state.keys[i]);
+        }
+      },
+      state.num_threads);
+  std::copy(survivors.begin(), survivors.end(), begin + middle);
+
+  filter_kruskal(state, middle, middle + survivors.size());
+}
 } // namespace detail::kruskal
 
 template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
@@ -94,25 +224,7 @@ std::vector<Edge<G>> kruskal(const G &graph, Weight weight) {
     Vertex<G> source = graph.get_source(edge);
     Vertex<G> target = graph.get_target(edge);
 
-    Vertex<G> source_root =
-        detail::kruskal::find_representative(ranked_sets, source);
-    Vertex<G> target_root =
-        detail::kruskal::find_representative(ranked_sets, target);
-
-    if (source_root != target_root) {
-      size_t source_set_rank = std::get<1>(ranked_sets[source_root]);
-      size_t target_set_rank = std::get<1>(ranked_sets[target_root]);
-
-      if (source_set_rank < target_set_rank) {
-        std::get<0>(ranked_sets[source_root]) = target_root;
-      } else {
-        std::get<0>(ranked_sets[target_root]) = source_root;
-      }
-
-      if (source_set_rank == target_set_rank) {
-        std::get<1>(ranked_sets[source_root])++;
-      }
-
+    if (detail::kruskal::unite(ranked_sets, source, target)) {
       minimum_spanning_tree.push_back(edge);
     }
   }
@@ -120,4 +232,45 @@ std::vector<Edge<G>> kruskal(const G &graph, Weight weight) {
   return minimum_spanning_tree;
 };
 
-} // namespace graphxx::algorithms
\ No newline at end of file
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+std::vector<Edge<G>> filter_kruskal(const G &graph, Weight weight,
+                                    size_t num_threads) {
+  using Id = Vertex<G>;
+  using Key = detail::kruskal::EdgeKey<Distance>;
+
+  size_t size = graph.num_vertices();
+
+  detail::kruskal::FilterKruskalState<G, Distance> state;
+  state.num_threads = num_threads;
+  state.threshold = std::max<size_t>(4 * size, 1 << 12);
+  state.ranked_sets.resize(size);
+  for (Id vertex = 0; vertex < size; vertex++) {
+    state.ranked_sets[vertex] = {vertex, 0};
+  }
+
+  std::vector<size_t> offsets =
+      detail::spanning_forest::number_spanning_candidates(graph, num_threads);
+
+  state.keys.resize(offsets[size]);
+  state.endpoints.resize(offsets[size]);
+  utils::parallel_for(
+      size_t{0}, size,
+      [&](size_t vertex) {
+        size_t index = offsets[vertex];
+        for (auto &edge : graph[vertex]) {
+          if (detail::spanning_forest::is_spanning_candidate(graph, edge)) {
+            state.keys[index] = Key{weight(edge), index};
+            state.endpoints[index] = {graph.get_source(edge),
+                                      graph.get_target(edge)};
+            ++index;
+          }
+        }
+      },
+      num_threads, size_t{256});
+
+  detail::kruskal::filter_kruskal(state, 0, state.keys.size());
+
+  return detail::spanning_forest::spanning_edges(graph, offsets, state.tree);
+}
+
+} // namespace graphxx::algorithms
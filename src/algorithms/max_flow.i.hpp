@@ -0,0 +1,409 @@
+/**
+ * @file This file is the header implementation of the maximum flow algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/residual_graph.hpp" // ResidualGraph
+#include "algorithms/max_flow.hpp"     // dinic, push_relabel
+#include "base.hpp"                    // Vertex, Edge
+#include "graph_concepts.hpp"          // Graph
+
+#include <algorithm> // std::min, std::max, std::fill
+#include <cstdint>   // size_t
+#include <limits>    // std::numeric_limits
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::max_flow {
+constexpr size_t UNREACHED = std::numeric_limits<size_t>::max();
+
+// Assigns to every vertex its distance from the source in the residual
+// network, stopping at the level of the sink
+template <concepts::Identifier Id, concepts::Numeric Flow>
+bool compute_levels(const ResidualGraph<Id, Flow> &network, Id source, Id sink,
+                    std::vector<size_t> &level, std::vector<Id> &queue) {
+  std::fill(level.begin(), level.end(), UNREACHED);
+  queue.clear();
+
+  level[source] = 0;
+  queue.push_back(source);
+  for (size_t i = 0; i < queue.size(); ++i) {
+    Id vertex = queue[i];
+    if (level[sink] != UNREACHED && level[vertex] >= level[sink]) {
+      break;
+    }
+    for (size_t arc = network.first_arc(vertex); arc < network.last_arc(vertex);
+         ++arc) {
+      Id head = network.head(arc);
+      if (network.residual(arc) > 0 && level[head] == UNREACHED) {
+        level[head] = level[vertex] + 1;
+        queue.push_back(head);
+      }
+    }
+  }
+
+  return level[sink] != UNREACHED;
+}
+
+// State of the highest-label push-relabel algorithm
+template <concepts::Identifier Id, concepts::Numeric Flow> class PushRelabel {
+public:
+  PushRelabel(ResidualGraph<Id, Flow> &network, Id source, Id sink)
+      : _network{network}, _size{network.num_vertices()}, _source{source},
+        _sink{sink}, _height(_size, 0), _current(_size), _excess(_size, 0),
+        _active(2 * _size + 1), _next(_size), _previous(_size),
+        _layers(_size, NONE) {}
+
+  Flow run() {
+    _height[_source] = _size;
+    for (size_t arc = _network.first_arc(_source);
+         arc < _network.last_arc(_source); ++arc) {
+      Flow amount = _network.residual(arc);
+      if (amount > 0) {
+        _network.push(arc, amount);
+        _excess[_network.head(arc)] += amount;
+        _excess[_source] -= amount;
+      }
+    }
+
+    global_relabel();
+
+    while (true) {
+      while (_highest > 0 && _active[_highest].empty()) {
+        --_highest;
+      }
+      if (_active[_highest].empty()) {
+        break;
+      }
+
+      Id vertex = _active[_highest].back();
+      _active[_highest].pop_back();
+      discharge(vertex);
+
+      if (_work > 6 * _size + _network.num_arcs()) {
+        global_relabel();
+      }
+    }
+
+    return _excess[_sink];
+  }
+
+private:
+  static constexpr Id NONE = std::numeric_limits<Id>::max();
+
+  void activate(Id vertex) {
+    _active[_height[vertex]].push_back(vertex);
+    _highest = std::max(_highest, _height[vertex]);
+  }
+
+  // Layers keep the vertices below height V, to detect gaps
+  void add_to_layer(Id vertex) {
+    size_t height = _height[vertex];
+    _previous[vertex] = NONE;
+    _next[vertex] = _layers[height];
+    if (_layers[height] != NONE) {
+      _previous[_layers[height]] = vertex;
+    }
+    _layers[height] = vertex;
+    _highest_layer = std::max(_highest_layer, height);
+  }
+
+  void remove_from_layer(Id vertex) {
+    if (_previous[vertex] != NONE) {
+      _next[_previous[vertex]] = _next[vertex];
+    } else {
+      _layers[_height[vertex]] = _next[vertex];
+    }
+    if (_next[vertex] != NONE) {
+      _previous[_next[vertex]] = _previous[vertex];
+    }
+  }
+
+  // Exact heights, as distances to the sink or, for the vertices that cannot
+  // reach it anymore, V plus the distance to the source
+  void global_relabel() {
+    _work = 0;
+    std::fill(_height.begin(), _height.end(), 2 * _size);
+    std::fill(_layers.begin(), _layers.end(), NONE);
+    for (auto &bucket : _active) {
+      bucket.clear();
+    }
+    _highest = 0;
+    _highest_layer = 0;
+
+    std::vector<Id> queue;
+    queue.reserve(_size);
+    for (Id root : {_sink, _source}) {
+      _height[root] = root == _sink ? 0 : _size;
+      queue.push_back(root);
+      for (size_t i = queue.size() - 1; i < queue.size(); ++i) {
+        Id vertex = queue[i];
+        for (size_t arc = _network.first_arc(vertex);
+             arc < _network.last_arc(vertex); ++arc) {
+          Id tail = _network.head(arc);
+          if (_height[tail] == 2 * _size && tail != _source &&
+              _network.residual(_network.reverse(arc)) > 0) {
+            _height[tail] = _height[vertex] + 1;
+            queue.push_back(tail);
+          }
+        }
+      }
+    }
+
+    for (Id vertex = 0; vertex < _size; ++vertex) {
+      if (vertex == _source || vertex == _sink) {
+        continue;
+      }
+      _current[vertex] = _network.first_arc(vertex);
+      if (_height[vertex] < _size) {
+        add_to_layer(vertex);
+      }
+      if (_excess[vertex] > 0 && _height[vertex] < 2 * _size) {
+        activate(vertex);
+      }
+    }
+  }
+
+  // No vertex is left at the given height, so the ones above it and below V
+  // cannot reach the sink: they are lifted above the source
+  void gap(size_t height) {
+    for (size_t layer = height + 1; layer <= _highest_layer; ++layer) {
+      for (Id vertex = _layers[layer]; vertex != NONE; vertex = _next[vertex]) {
+        _height[vertex] = _size + 1;
+        _current[vertex] = _network.first_arc(vertex);
+      }
+      _layers[layer] = NONE;
+
+      auto &bucket = _active[layer];
+      _active[_size + 1].insert(_active[_size + 1].end(), bucket.begin(),
+                                bucket.end());
+      if (!bucket.empty()) {
+        _highest = std::max(_highest, _size + 1);
+      }
+      bucket.clear();
+    }
+    _highest_layer = height > 0 ? height - 1 : 0;
+  }
+
+  void relabel(Id vertex) {
+    size_t old_height = _height[vertex];
+    size_t new_height = 2 * _size;
+    for (size_t arc = _network.first_arc(vertex);
+         arc < _network.last_arc(vertex); ++arc) {
+      if (_network.residual(arc) > 0) {
+        new_height = std::min(new_height, _height[_network.head(arc)] + 1);
+      }
+    }
+    _work += _network.last_arc(vertex) - _network.first_arc(vertex) + 12;
+    _current[vertex] = _network.first_arc(vertex);
+
+    if (old_height < _size) {
+      remove_from_layer(vertex);
+      if (old_height > 0 && _layers[old_height] == NONE) {
+        gap(old_height);
+        new_height = std::max(new_height, _size + 1);
+      }
+    }
+
+    _height[vertex] = new_height;
+    if (new_height < _size) {
+      add_to_layer(vertex);
+    }
+  }
+
+  void discharge(Id vertex) {
+    while (_excess[vertex] > 0) {
+      if (_current[vertex] == _network.last_arc(vertex)) {
+        relabel(vertex);
+        if (_height[vertex] >= 2 * _size) {
+          break;
+        }
+        continue;
+      }
+
+      size_t arc = _current[vertex];
+      Id head = _network.head(arc);
+      if (_network.residual(arc) > 0 && _height[vertex] == _height[head] + 1) {
+        Flow amount = std::min(_excess[vertex], _network.residual(arc));
+        _network.push(arc, amount);
+        _excess[vertex] -= amount;
+        if (_excess[head] == 0 && head != _source && head != _sink) {
+          _excess[head] += amount;
+          activate(head);
+        } else {
+          _excess[head] += amount;
+        }
+      } else {
+        ++_current[vertex];
+      }
+    }
+  }
+
+  ResidualGraph<Id, Flow> &_network;
+  size_t _size;
+  Id _source;
+  Id _sink;
+  std::vector<size_t> _height;
+  std::vector<size_t> _current;
+  std::vector<Flow> _excess;
+  // Active vertices by height
+  std::vector<std::vector<Id>> _active;
+  size_t _highest = 0;
+  // Doubly linked lists of the vertices by height, for the heights below V
+  std::vector<Id> _next;
+  std::vector<Id> _previous;
+  std::vector<Id> _layers;
+  size_t _highest_layer = 0;
+  // Work done since the last global relabel
+  size_t _work = 0;
+};
+} // namespace detail::max_flow
+
+template <concepts::Identifier Id, concepts::Numeric Flow>
+Flow dinic(ResidualGraph<Id, Flow> &network, std::type_identity_t<Id> source,
+           std::type_identity_t<Id> sink) {
+  using detail::max_flow::UNREACHED;
+
+  if (source == sink) {
+    return 0;
+  }
+
+  size_t size = network.num_vertices();
+  std::vector<size_t> level(size);
+  std::vector<size_t> current(size);
+  std::vector<Id> queue;
+  queue.reserve(size);
+  std::vector<size_t> path;
+
+  Flow max_flow = 0;
+  while (detail::max_flow::compute_levels(network, source, sink, level,
+                                          queue)) {
+    for (Id vertex = 0; vertex < size; ++vertex) {
+      current[vertex] = network.first_arc(vertex);
+    }
+
+    // Blocking flow: the path grows along admissible arcs, and retreats from
+    // dead ends, which are removed from the level graph
+    Id vertex = source;
+    path.clear();
+    while (true) {
+      if (vertex == sink) {
+        Flow amount = network.residual(path[0]);
+        for (size_t arc : path) {
+          amount = std::min(amount, network.residual(arc));
+        }
+
+        size_t saturated = path.size();
+        for (size_t i = 0; i < path.size(); ++i) {
+          network.push(path[i], amount);
+          if (saturated == path.size() && network.residual(path[i]) == 0) {
+            saturated = i;
+          }
+        }
+        max_flow += amount;
+
+        path.resize(saturated);
+        vertex = path.empty() ? source : network.head(path.back());
+        continue;
+      }
+
+      size_t &arc = current[vertex];
+      while (arc < network.last_arc(vertex) &&
+             (network.residual(arc) == 0 ||
+              level[network.head(arc)] != level[vertex] + 1)) {
+        ++arc;
+      }
+
+      if (arc < network.last_arc(vertex)) {
+        path.push_back(arc);
+        vertex = network.head(arc);
+      } else if (vertex == source) {
+        break;
+      } else {
+        level[vertex] = UNREACHED;
+        path.pop_back();
+        vertex = path.empty() ? source : network.head(path.back());
+        ++current[vertex];
+      }
+    }
+  }
+
+  return max_flow;
+}
+
+template <concepts::Graph G, std::invocable<Edge<G>> Capacity, typename Flow>
+Flow dinic(const G &graph, Vertex<G> source, Vertex<G> sink,
+           Capacity capacity) {
+  auto network = make_residual_graph(graph, capacity);
+  return dinic(network, source, sink);
+}
+
+template <concepts::Identifier Id, concepts::Numeric Flow>
+Flow push_relabel(ResidualGraph<Id, Flow> &network,
+                  std::type_identity_t<Id> source,
+                  std::type_identity_t<Id> sink) {
+  if (source == sink) {
+    return 0;
+  }
+
+  return detail::max_flow::PushRelabel<Id, Flow>(network, source, sink).run();
+}
+
+template <concepts::Graph G, std::invocable<Edge<G>> Capacity, typename Flow>
+Flow push_relabel(const G &graph, Vertex<G> source, Vertex<G> sink,
+                  Capacity capacity) {
+  auto network = make_residual_graph(graph, capacity);
+  return push_relabel(network, source, sink);
+}
+
+template <concepts::Identifier Id, concepts::Numeric Flow>
+std::vector<bool> min_cut(const ResidualGraph<Id, Flow> &network,
+                          std::type_identity_t<Id> source) {
+  std::vector<bool> reachable(network.num_vertices(), false);
+  std::vector<Id> queue{source};
+  reachable[source] = true;
+
+  for (size_t i = 0; i < queue.size(); ++i) {
+    Id vertex = queue[i];
+    for (size_t arc = network.first_arc(vertex); arc < network.last_arc(vertex);
+         ++arc) {
+      Id head = network.head(arc);
+      if (network.residual(arc) > 0 && !reachable[head]) {
+        reachable[head] = true;
+        queue.push_back(head);
+      }
+    }
+  }
+
+  return reachable;
+}
+
+} // namespace graphxx::algorithms
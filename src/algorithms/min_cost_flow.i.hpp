@@ -0,0 +1,209 @@
+/**
+ * @file This file is the header implementation of the minimum cost flow algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/residual_graph.hpp"  // ResidualGraph
+#include "algorithms/min_cost_flow.hpp" // min_cost_flow
+#include "base.hpp"                     // Vertex, Edge
+#include "exceptions.hpp"     // exceptions::InvariantViolationException
+#include "graph_concepts.hpp" // Graph
+#include "indexed_heap.hpp"   // IndexedHeap
+
+#include <algorithm> // std::min
+#include <cstdint>   // size_t
+#include <limits>    // std::numeric_limits
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::min_cost_flow {
+// Potentials that make every reduced cost non negative, computed with
+// Bellman-Ford from a virtual vertex connected to all the others at no cost
+template <concepts::Identifier Id, concepts::Numeric Flow,
+          concepts::Numeric Cost>
+std::vector<Cost> initial_potentials(const ResidualGraph<Id, Flow> &network,
+                                     const std::vector<Cost> &cost) {
+  size_t size = network.num_vertices();
+  std::vector<Cost> potential(size, 0);
+
+  for (size_t round = 0; round <= size; ++round) {
+    bool changed = false;
+    for (Id vertex = 0; vertex < size; ++vertex) {
+      for (size_t arc = network.first_arc(vertex);
+           arc < network.last_arc(vertex); ++arc) {
+        Id head = network.head(arc);
+        if (network.residual(arc) > 0 &&
+            potential[vertex] + cost[arc] < potential[head]) {
+          potential[head] = potential[vertex] + cost[arc];
+          changed = true;
+        }
+      }
+    }
+    if (!changed) {
+      return potential;
+    }
+  }
+
+  throw exceptions::InvariantViolationException("negative cycle found");
+}
+} // namespace detail::min_cost_flow
+
+template <concepts::Identifier Id, concepts::Numeric Flow,
+          concepts::Numeric Cost>
+MinCostFlow<Flow, Cost>
+min_cost_flow(ResidualGraph<Id, Flow> &network, const std::vector<Cost> &cost,
+              std::type_identity_t<Id> source, std::type_identity_t<Id> sink,
+              Flow flow_limit) {
+  constexpr size_t NO_ARC = std::numeric_limits<size_t>::max();
+
+  MinCostFlow<Flow, Cost> result{0, 0, {}};
+  if (source == sink) {
+    return result;
+  }
+
+  size_t size = network.num_vertices();
+
+  bool negative_costs = false;
+  for (size_t arc = 0; arc < network.num_arcs(); ++arc) {
+    negative_costs |= network.residual(arc) > 0 && cost[arc] < 0;
+  }
+  std::vector<Cost> potential =
+      negative_costs
+          ? detail::min_cost_flow::initial_potentials(network, cost)
+          : std::vector<Cost>(size, 0);
+
+  std::vector<Cost> distance(size);
+  std::vector<size_t> parent_arc(size, NO_ARC);
+  std::vector<bool> settled(size, false);
+  std::vector<Id> settled_vertices;
+  utils::IndexedHeap<Cost> heap(size);
+
+  while (result.flow < flow_limit) {
+    // Dijkstra on the reduced costs, up to the sink
+    for (Id vertex : settled_vertices) {
+      settled[vertex] = false;
+    }
+    settled_vertices.clear();
+    heap.clear();
+
+    heap.push(source, 0);
+    parent_arc[source] = NO_ARC;
+    while (!heap.empty()) {
+      Cost vertex_distance = heap.top_priority();
+      auto vertex = static_cast<Id>(heap.pop());
+      settled[vertex] = true;
+      distance[vertex] = vertex_distance;
+      settled_vertices.push_back(vertex);
+      if (vertex == sink) {
+        break;
+      }
+
+      for (size_t arc = network.first_arc(vertex);
+           arc < network.last_arc(vertex); ++arc) {
+        Id head = network.head(arc);
+        if (network.residual(arc) == 0 || settled[head]) {
+          continue;
+        }
+        Cost reduced = cost[arc] + potential[vertex] - potential[head];
+        if (heap.push_or_decrease(head, vertex_distance + reduced)) {
+          parent_arc[head] = arc;
+        }
+      }
+    }
+
+    if (!settled[sink]) {
+      break;
+    }
+
+    // Vertices farther than the sink keep their potential, which preserves
+    // non negative reduced costs on every arc with available capacity
+    for (Id vertex : settled_vertices) {
+      potential[vertex] += distance[vertex] - distance[sink];
+    }
+
+    Flow amount = flow_limit - result.flow;
+    for (Id vertex = sink; vertex != source;
+         vertex = network.head(network.reverse(parent_arc[vertex]))) {
+      amount = std::min(amount, network.residual(parent_arc[vertex]));
+    }
+
+    Cost path_cost = 0;
+    for (Id vertex = sink; vertex != source;
+         vertex = network.head(network.reverse(parent_arc[vertex]))) {
+      network.push(parent_arc[vertex], amount);
+      path_cost += cost[parent_arc[vertex]];
+    }
+
+    result.flow += amount;
+    result.cost += path_cost * amount;
+  }
+
+  return result;
+}
+
+template <concepts::Graph G, std::invocable<Edge<G>> Capacity,
+          std::invocable<Edge<G>> CostFunction, typename Flow, typename Cost>
+MinCostFlow<Flow, Cost> min_cost_flow(const G &graph, Vertex<G> source,
+                                      Vertex<G> sink, Capacity capacity,
+                                      CostFunction cost, Flow flow_limit) {
+  auto network = make_directed_residual_graph(graph, capacity);
+
+  std::vector<Cost> edge_cost;
+  edge_cost.reserve(graph.num_edges());
+  for (Vertex<G> vertex = 0; vertex < graph.num_vertices(); ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      edge_cost.push_back(cost(edge));
+    }
+  }
+
+  std::vector<Cost> arc_cost(network.num_arcs());
+  for (size_t arc = 0; arc < network.num_arcs(); ++arc) {
+    size_t edge_id = network.edge_id(arc);
+    if (edge_id != network.NO_EDGE) {
+      arc_cost[arc] = edge_cost[edge_id];
+      arc_cost[network.reverse(arc)] = -edge_cost[edge_id];
+    }
+  }
+
+  auto result = min_cost_flow(network, arc_cost, source, sink, flow_limit);
+
+  result.edge_flow.assign(edge_cost.size(), 0);
+  for (size_t arc = 0; arc < network.num_arcs(); ++arc) {
+    size_t edge_id = network.edge_id(arc);
+    if (edge_id != network.NO_EDGE) {
+      result.edge_flow[edge_id] = network.flow(arc);
+    }
+  }
+
+  return result;
+}
+
+} // namespace graphxx::algorithms
@@ -0,0 +1,188 @@
+/**
+ * @file This file is the header implementation of the PageRank algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // make_transposed_csr
+#include "algorithms/pagerank.hpp"            // pagerank
+#include "exceptions.hpp"                     // InvariantViolationException
+#include "graph_concepts.hpp"                 // Graph, Identifier
+#include "utils/parallel_utils.hpp"           // parallel_for_chunks
+
+#include <cmath>    // std::abs
+#include <concepts> // std::floating_point
+#include <cstdint>  // size_t
+#include <numeric>  // std::accumulate
+#include <vector>   // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::pagerank {
+// Number of vertices in every chunk, each one with its own partial sums
+constexpr size_t GRAIN = 4096;
+
+// Power iteration, where teleport holds the normalized teleport probability
+// of every vertex, or is empty for the uniform one
+template <std::floating_point Rank, concepts::Identifier Id>
+std::vector<Rank> run(const CompressedSparseRow<Id> &in_edges,
+                      const std::vector<Rank> &teleport, Rank damping,
+                      Rank tolerance, size_t max_iterations,
+                      size_t num_threads) {
+  size_t size = in_edges.num_vertices();
+  if (size == 0) {
+    return {};
+  }
+
+  // Out degrees are the occurrences of every vertex among the sources
+  std::vector<size_t> out_degree(size, 0);
+  for (auto source : in_edges.targets()) {
+    ++out_degree[source];
+  }
+
+  auto uniform = static_cast<Rank>(1.0 / static_cast<double>(size));
+  auto teleport_of = [&](size_t vertex) {
+    return teleport.empty() ? uniform : teleport[vertex];
+  };
+
+  std::vector<Rank> rank(size);
+  // Rank divided by out degree, pushed along every out edge of a vertex
+  std::vector<Rank> contribution(size);
+  std::vector<Rank> next_contribution(size);
+  double dangling = 0;
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    rank[vertex] = teleport_of(vertex);
+    if (out_degree[vertex] == 0) {
+      dangling += rank[vertex];
+    } else {
+      contribution[vertex] = rank[vertex] / out_degree[vertex];
+    }
+  }
+
+  size_t num_chunks = (size + GRAIN - 1) / GRAIN;
+  std::vector<double> chunk_dangling(num_chunks);
+  std::vector<double> chunk_distance(num_chunks);
+
+  for (size_t iteration = 0; iteration < max_iterations; ++iteration) {
+    auto teleported = static_cast<Rank>(1 - damping + damping * dangling);
+
+    utils::parallel_for_chunks(
+        size_t{0}, size,
+        [&](size_t, size_t first, size_t last) {
+          double dangling_sum = 0;
+          double distance = 0;
+          for (size_t vertex = first; vertex < last; ++vertex) {
+            Rank sum = 0;
+            for (auto source : in_edges[static_cast<Id>(vertex)]) {
+              sum += contribution[source];
+            }
+            Rank value = teleported * teleport_of(vertex) + damping * sum;
+            distance += std::abs(value - rank[vertex]);
+            rank[vertex] = value;
+            if (out_degree[vertex] == 0) {
+              dangling_sum += value;
+            } else {
+              next_contribution[vertex] = value / out_degree[vertex];
+            }
+          }
+          chunk_dangling[first / GRAIN] = dangling_sum;
+          chunk_distance[first / GRAIN] = distance;
+        },
+        num_threads, GRAIN);
+
+    contribution.swap(next_contribution);
+    dangling = std::accumulate(chunk_dangling.begin(), chunk_dangling.end(),
+                               0.0);
+    if (std::accumulate(chunk_distance.begin(), chunk_distance.end(), 0.0) <
+        tolerance) {
+      break;
+    }
+  }
+
+  return rank;
+}
+} // namespace detail::pagerank
+
+template <std::floating_point Rank, concepts::Identifier Id>
+std::vector<Rank> pagerank(const CompressedSparseRow<Id> &in_edges,
+                           Rank damping, Rank tolerance, size_t max_iterations,
+                           size_t num_threads) {
+  return detail::pagerank::run<Rank>(in_edges, {}, damping, tolerance,
+                                     max_iterations, num_threads);
+}
+
+template <std::floating_point Rank, concepts::Graph G>
+std::vector<Rank> pagerank(const G &graph, Rank damping, Rank tolerance,
+                           size_t max_iterations, size_t num_threads) {
+  return pagerank<Rank>(make_transposed_csr(graph), damping, tolerance,
+                        max_iterations, num_threads);
+}
+
+template <std::floating_point Rank, concepts::Identifier Id>
+std::vector<Rank> personalized_pagerank(
+    const CompressedSparseRow<Id> &in_edges,
+    const std::vector<Rank> &personalization, Rank damping, Rank tolerance,
+    size_t max_iterations, size_t num_threads) {
+  if (personalization.size() != in_edges.num_vertices()) {
+    throw exceptions::InvariantViolationException(
+        "personalization size differs from number of vertices");
+  }
+
+  double total = 0;
+  for (auto weight : personalization) {
+    if (weight < 0) {
+      throw exceptions::InvariantViolationException(
+          "negative personalization weight found");
+    }
+    total += weight;
+  }
+  if (total == 0 && !personalization.empty()) {
+    throw exceptions::InvariantViolationException(
+        "personalization weights sum up to zero");
+  }
+
+  std::vector<Rank> teleport(personalization.size());
+  for (size_t vertex = 0; vertex < teleport.size(); ++vertex) {
+    teleport[vertex] = static_cast<Rank>(personalization[vertex] / total);
+  }
+
+  return detail::pagerank::run<Rank>(in_edges, teleport, damping, tolerance,
+                                     max_iterations, num_threads);
+}
+
+template <std::floating_point Rank, concepts::Graph G>
+std::vector<Rank> personalized_pagerank(
+    const G &graph, const std::vector<Rank> &personalization, Rank damping,
+    Rank tolerance, size_t max_iterations, size_t num_threads) {
+  return personalized_pagerank<Rank>(make_transposed_csr(graph),
+                                     personalization, damping, tolerance,
+                                     max_iterations, num_threads);
+}
+
+} // namespace graphxx::algorithms
@@ -0,0 +1,398 @@
+/**
+ * @file This file is the header implementation of the parallel strongly connected
+ * components algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "algorithms/parallel_scc.hpp"        // parallel_scc
+#include "base.hpp"                           // Vertex
+#include "graph_concepts.hpp"                 // Graph
+#include "utils/parallel_utils.hpp"           // parallel_collect
+
+#include <algorithm> // std::max
+#include <atomic>    // std::atomic_ref
+#include <cstdint>   // size_t, uint8_t
+#include <limits>    // std::numeric_limits
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::parallel_scc {
+template <concepts::Identifier Id>
+constexpr Id UNASSIGNED = std::numeric_limits<Id>::max();
+
+template <typename T> T load(T &value) {
+  return std::atomic_ref<T>(value).load(std::memory_order_relaxed);
+}
+
+// Atomically replaces `value` with `candidate` if the latter is greater.
+// Returns true if the value has been replaced
+template <typename T> bool fetch_max(T &value, T candidate) {
+  std::atomic_ref<T> ref(value);
+  T current = ref.load(std::memory_order_relaxed);
+  while (current < candidate) {
+    if (ref.compare_exchange_weak(current, candidate,
+                                  std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Vertices without in or out edges toward unassigned vertices are components
+// by themselves: they are removed and their neighbours' degrees decremented,
+// until no more vertices can be trimmed
+template <concepts::Identifier Id>
+void trim(const CompressedSparseRow<Id> &out_edges,
+          const CompressedSparseRow<Id> &in_edges, const std::vector<Id> &active,
+          std::vector<Id> &component, std::vector<Id> &out_degree,
+          std::vector<Id> &in_degree, size_t num_threads) {
+  auto count_unassigned = [&](const CompressedSparseRow<Id> &edges, Id v) {
+    Id count = 0;
+    for (Id w : edges[v]) {
+      if (w != v && component[w] == UNASSIGNED<Id>) {
+        ++count;
+      }
+    }
+    return count;
+  };
+
+  std::vector<Id> frontier = utils::parallel_collect<Id>(
+      size_t{0}, active.size(),
+      [&](size_t i, std::vector<Id> &output) {
+        Id v = active[i];
+        out_degree[v] = count_unassigned(out_edges, v);
+        in_degree[v] = count_unassigned(in_edges, v);
+        if (out_degree[v] == 0 || in_degree[v] == 0) {
+          output.push_back(v);
+        }
+      },
+      num_threads);
+
+  utils::parallel_for(
+      size_t{0}, frontier.size(),
+      [&](size_t i) { component[frontier[i]] = frontier[i]; }, num_threads);
+
+  auto claim = [&](Id w) {
+    Id expected = UNASSIGNED<Id>;
+    return std::atomic_ref<Id>(component[w])
+        .compare_exchange_strong(expected, w, std::memory_order_relaxed);
+  };
+
+  auto remove_edges = [&](const CompressedSparseRow<Id> &edges, Id v,
+                          std::vector<Id> &degree, std::vector<Id> &output) {
+    for (Id w : edges[v]) {
+      if (w == v || load(component[w]) != UNASSIGNED<Id>) {
+        continue;
+      }
+      if (std::atomic_ref<Id>(degree[w]).fetch_sub(
+              1, std::memory_order_relaxed) == 1 &&
+          claim(w)) {
+        output.push_back(w);
+      }
+    }
+  };
+
+  while (!frontier.empty()) {
+    frontier = utils::parallel_collect<Id>(
+        size_t{0}, frontier.size(),
+        [&](size_t i, std::vector<Id> &output) {
+          remove_edges(out_edges, frontier[i], in_degree, output);
+          remove_edges(in_edges, frontier[i], out_degree, output);
+        },
+        num_threads);
+  }
+}
+
+template <concepts::Identifier Id>
+std::vector<Id> unassigned_vertices(const std::vector<Id> &vertices,
+                                    const std::vector<Id> &component,
+                                    size_t num_threads) {
+  return utils::parallel_collect<Id>(
+      size_t{0}, vertices.size(),
+      [&](size_t i, std::vector<Id> &output) {
+        if (component[vertices[i]] == UNASSIGNED<Id>) {
+          output.push_back(vertices[i]);
+        }
+      },
+      num_threads);
+}
+
+// Level synchronous visit of the unassigned vertices reachable from `source`,
+// which sets `bit` in the mark of every reached vertex
+template <concepts::Identifier Id>
+void mark_reachable(const CompressedSparseRow<Id> &edges, Id source,
+                    uint8_t bit, const std::vector<Id> &component,
+                    std::vector<uint8_t> &mark, size_t num_threads) {
+  mark[source] |= bit;
+  std::vector<Id> frontier{source};
+
+  while (!frontier.empty()) {
+    frontier = utils::parallel_collect<Id>(
+        size_t{0}, frontier.size(),
+        [&](size_t i, std::vector<Id> &output) {
+          for (Id w : edges[frontier[i]]) {
+            if (component[w] != UNASSIGNED<Id> || (load(mark[w]) & bit)) {
+              continue;
+            }
+            if (!(std::atomic_ref<uint8_t>(mark[w])
+                      .fetch_or(bit, std::memory_order_relaxed) &
+                  bit)) {
+              output.push_back(w);
+            }
+          }
+        },
+        num_threads, size_t{64});
+  }
+}
+
+// Extracts the component of the vertex with the highest product of in and out
+// degree, that in real world graphs usually belongs to the giant component
+template <concepts::Identifier Id>
+void forward_backward(const CompressedSparseRow<Id> &out_edges,
+                      const CompressedSparseRow<Id> &in_edges,
+                      const std::vector<Id> &active, std::vector<Id> &component,
+                      const std::vector<Id> &out_degree,
+                      const std::vector<Id> &in_degree, size_t num_threads) {
+  if (active.empty()) {
+    return;
+  }
+
+  std::vector<Id> best(std::max<size_t>(num_threads, 1), active[0]);
+  auto score = [&](Id v) {
+    return static_cast<double>(out_degree[v]) * in_degree[v];
+  };
+
+  utils::parallel_for_chunks(
+      size_t{0}, active.size(),
+      [&](size_t thread_id, size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+          if (score(active[i]) > score(best[thread_id])) {
+            best[thread_id] = active[i];
+          }
+        }
+      },
+      num_threads);
+
+  Id pivot = best[0];
+  for (Id candidate : best) {
+    if (score(candidate) > score(pivot)) {
+      pivot = candidate;
+    }
+  }
+
+  std::vector<uint8_t> mark(component.size(), 0);
+  mark_reachable(out_edges, pivot, uint8_t{1}, component, mark, num_threads);
+  mark_reachable(in_edges, pivot, uint8_t{2}, component, mark, num_threads);
+
+  utils::parallel_for(
+      size_t{0}, active.size(),
+      [&](size_t i) {
+        if (mark[active[i]] == 3) {
+          component[active[i]] = pivot;
+        }
+      },
+      num_threads);
+}
+
+// Propagates forward the largest color, then assigns to every root (a vertex
+// whose color is its own id) the vertices of its color that reach it
+template <concepts::Identifier Id>
+void coloring(const CompressedSparseRow<Id> &out_edges,
+              const CompressedSparseRow<Id> &in_edges,
+              const std::vector<Id> &active, std::vector<Id> &component,
+              std::vector<Id> &color, std::vector<uint8_t> &queued,
+              size_t num_threads) {
+  utils::parallel_for(
+      size_t{0}, active.size(), [&](size_t i) { color[active[i]] = active[i]; },
+      num_threads);
+
+  std::vector<Id> frontier = active;
+
+  while (!frontier.empty()) {
+    std::vector<Id> next = utils::parallel_collect<Id>(
+        size_t{0}, frontier.size(),
+        [&](size_t i, std::vector<Id> &output) {
+          Id v = frontier[i];
+          Id v_color = load(color[v]);
+          for (Id w : out_edges[v]) {
+            if (component[w] != UNASSIGNED<Id> ||
+                !fetch_max(color[w], v_color)) {
+              continue;
+            }
+            if (!std::atomic_ref<uint8_t>(queued[w]).exchange(
+                    1, std::memory_order_relaxed)) {
+              output.push_back(w);
+            }
+          }
+        },
+        num_threads);
+
+    utils::parallel_for(
+        size_t{0}, next.size(), [&](size_t i) { queued[next[i]] = 0; },
+        num_threads);
+    frontier = std::move(next);
+  }
+
+  std::vector<Id> roots = utils::parallel_collect<Id>(
+      size_t{0}, active.size(),
+      [&](size_t i, std::vector<Id> &output) {
+        if (color[active[i]] == active[i]) {
+          output.push_back(active[i]);
+        }
+      },
+      num_threads);
+
+  // The backward visits of different roots touch disjoint sets of vertices
+  utils::parallel_for_chunks(
+      size_t{0}, roots.size(),
+      [&](size_t, size_t first, size_t last) {
+        std::vector<Id> stack;
+        for (size_t i = first; i < last; ++i) {
+          Id root = roots[i];
+          component[root] = root;
+          stack.push_back(root);
+
+          while (!stack.empty()) {
+            Id v = stack.back();
+            stack.pop_back();
+            for (Id w : in_edges[v]) {
+              if (color[w] == root && component[w] == UNASSIGNED<Id>) {
+                component[w] = root;
+                stack.push_back(w);
+              }
+            }
+          }
+        }
+      },
+      num_threads, size_t{1});
+}
+} // namespace detail::parallel_scc
+
+template <concepts::Graph G>
+SCCComponents<Vertex<G>> parallel_scc(const G &graph, size_t num_threads) {
+  return parallel_scc(make_csr(graph), make_transposed_csr(graph),
+                      num_threads);
+}
+
+template <concepts::Identifier Id>
+SCCComponents<Id> parallel_scc(const CompressedSparseRow<Id> &out_edges,
+                               const CompressedSparseRow<Id> &in_edges,
+                               size_t num_threads) {
+  using detail::parallel_scc::UNASSIGNED;
+
+  size_t num_vertices = out_edges.num_vertices();
+  std::vector<Id> component(num_vertices, UNASSIGNED<Id>);
+  std::vector<Id> out_degree(num_vertices, 0);
+  std::vector<Id> in_degree(num_vertices, 0);
+
+  std::vector<Id> active(num_vertices);
+  utils::parallel_for(
+      size_t{0}, num_vertices,
+      [&](size_t v) { active[v] = static_cast<Id>(v); }, num_threads);
+
+  detail::parallel_scc::trim(out_edges, in_edges, active, component,
+                             out_degree, in_degree, num_threads);
+  active = detail::parallel_scc::unassigned_vertices(active, component,
+                                                     num_threads);
+
+  detail::parallel_scc::forward_backward(out_edges, in_edges, active,
+                                         component, out_degree, in_degree,
+                                         num_threads);
+  active = detail::parallel_scc::unassigned_vertices(active, component,
+                                                     num_threads);
+
+  std::vector<Id> color(num_vertices, 0);
+  std::vector<uint8_t> queued(num_vertices, 0);
+
+  while (!active.empty()) {
+    detail::parallel_scc::trim(out_edges, in_edges, active, component,
+                               out_degree, in_degree, num_threads);
+    active = detail::parallel_scc::unassigned_vertices(active, component,
+                                                       num_threads);
+
+    detail::parallel_scc::coloring(out_edges, in_edges, active, component,
+                                   color, queued, num_threads);
+    active = detail::parallel_scc::unassigned_vertices(active, component,
+                                                       num_threads);
+  }
+
+  // Every component is labelled by one of its vertices: relabel them with
+  // consecutive ids, in order of their smallest vertex
+  SCCComponents<Id> result;
+  result.component.resize(num_vertices);
+  std::vector<Id> new_id(num_vertices, UNASSIGNED<Id>);
+
+  for (size_t v = 0; v < num_vertices; ++v) {
+    Id label = component[v];
+    if (new_id[label] == UNASSIGNED<Id>) {
+      new_id[label] = static_cast<Id>(result.sizes.size());
+      result.sizes.push_back(0);
+    }
+    result.component[v] = new_id[label];
+    ++result.sizes[new_id[label]];
+  }
+
+  return result;
+}
+
+template <concepts::Identifier Id>
+SCCVector<Id> to_scc_vector(const SCCComponents<Id> &components) {
+  SCCVector<Id> scc_vector(components.sizes.size());
+  for (size_t i = 0; i < components.sizes.size(); ++i) {
+    scc_vector[i].reserve(components.sizes[i]);
+  }
+
+  for (size_t v = 0; v < components.component.size(); ++v) {
+    scc_vector[components.component[v]].push_back(static_cast<Id>(v));
+  }
+
+  return scc_vector;
+}
+
+template <concepts::Identifier Id>
+SCCComponents<Id> to_scc_components(const SCCVector<Id> &scc_vector,
+                                    size_t num_vertices) {
+  SCCComponents<Id> components;
+  components.component.resize(num_vertices);
+  components.sizes.reserve(scc_vector.size());
+
+  for (size_t i = 0; i < scc_vector.size(); ++i) {
+    for (Id vertex : scc_vector[i]) {
+      components.component[vertex] = static_cast<Id>(i);
+    }
+    components.sizes.push_back(scc_vector[i].size());
+  }
+
+  return components;
+}
+
+} // namespace graphxx::algorithms
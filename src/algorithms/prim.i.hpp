@@ -0,0 +1,87 @@
+/**
+ * @file This file is the header implementation of the Prim algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "algorithms/prim.hpp" // prim
+#include "base.hpp"            // Edge
+#include "graph_concepts.hpp"  // Graph
+#include "indexed_heap.hpp"    // IndexedHeap
+
+#include <cstdint> // size_t
+#include <vector>  // std::vector
+
+namespace graphxx::algorithms {
+
+template <concepts::Graph G, std::invocable<Edge<G>> Weight, typename Distance>
+std::vector<Edge<G>> prim(const G &graph, Weight weight) {
+  size_t size = graph.num_vertices();
+
+  std::vector<Edge<G>> minimum_spanning_tree;
+  minimum_spanning_tree.reserve(size > 0 ? size - 1 : 0);
+
+  // Lightest known edge connecting every vertex to the tree, meaningful only
+  // for the vertices in the heap
+  std::vector<Edge<G>> connecting_edge(size);
+  std::vector<bool> in_tree(size, false);
+  utils::IndexedHeap<Distance> heap(size);
+
+  for (Vertex<G> root = 0; root < size; ++root) {
+    if (in_tree[root]) {
+      continue;
+    }
+
+    in_tree[root] = true;
+    Vertex<G> vertex = root;
+    while (true) {
+      for (auto &&edge : graph[vertex]) {
+        Vertex<G> target = graph.get_target(edge);
+        if (in_tree[target]) {
+          continue;
+        }
+        if (heap.push_or_decrease(target, weight(edge))) {
+          connecting_edge[target] = edge;
+        }
+      }
+
+      if (heap.empty()) {
+        break;
+      }
+
+      vertex = static_cast<Vertex<G>>(heap.pop());
+      in_tree[vertex] = true;
+      minimum_spanning_tree.push_back(connecting_edge[vertex]);
+    }
+  }
+
+  return minimum_spanning_tree;
+}
+
+} // namespace graphxx::algorithms
@@ -0,0 +1,367 @@
+/**
+ * @file This file is the header implementation of the random walks generator
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "algorithms/random_walks.hpp"        // RandomWalker, RandomWalks
+#include "base.hpp"                           // Vertex, Edge
+#include "exceptions.hpp"                     // InvariantViolationException
+#include "graph_concepts.hpp"                 // Graph
+#include "utils/parallel_utils.hpp"           // parallel_for_chunks
+#include "utils/random_utils.hpp"             // CounterRng
+
+#include <algorithm> // std::sort, std::binary_search, std::fill, std::min
+#include <array>     // std::array
+#include <cstdint>   // size_t, uint64_t
+#include <span>      // std::span
+#include <utility>   // std::pair, std::move
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::random_walks {
+// Number of vertices or walks assigned to a thread at a time
+constexpr size_t GRAIN = 256;
+// Number of walks advanced together by a thread
+constexpr size_t BATCH = 16;
+
+// Vose's alias method: every entry keeps itself with its probability and is
+// replaced by its alias otherwise, so that sampling a uniform entry draws the
+// entries proportionally to their weights
+inline void build_alias(std::span<const double> weights, double *probability,
+                        size_t *alias, std::vector<size_t> &small,
+                        std::vector<size_t> &large) {
+  double total = 0;
+  for (auto weight : weights) {
+    total += weight;
+  }
+  small.clear();
+  large.clear();
+  for (size_t i = 0; i < weights.size(); ++i) {
+    probability[i] =
+        weights[i] * static_cast<double>(weights.size()) / total;
+    alias[i] = i;
+    (probability[i] < 1 ? small : large).push_back(i);
+  }
+
+  // Every small entry is filled up by a large one, which may become small
+  while (!small.empty() && !large.empty()) {
+    size_t less = small.back();
+    small.pop_back();
+    size_t more = large.back();
+    alias[less] = more;
+    probability[more] -= 1 - probability[less];
+    if (probability[more] < 1) {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+  // What is left is one up to rounding errors
+  for (auto i : small) {
+    probability[i] = 1;
+  }
+  for (auto i : large) {
+    probability[i] = 1;
+  }
+}
+} // namespace detail::random_walks
+
+template <concepts::Graph G>
+RandomWalker<G>::RandomWalker(const G &graph, size_t num_threads) {
+  std::vector<size_t> offsets(graph.num_vertices() + 1, 0);
+  std::vector<Vertex> targets;
+  targets.reserve(graph.num_edges());
+  for (Vertex vertex = 0; vertex < graph.num_vertices(); ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      targets.push_back(graph.get_target(edge));
+    }
+    offsets[vertex + 1] = targets.size();
+  }
+
+  utils::parallel_for_chunks(
+      size_t{0}, graph.num_vertices(),
+      [&](size_t, size_t first, size_t last) {
+        for (size_t vertex = first; vertex < last; ++vertex) {
+          std::sort(targets.begin() + offsets[vertex],
+                    targets.begin() + offsets[vertex + 1]);
+        }
+      },
+      num_threads, detail::random_walks::GRAIN);
+
+  _adjacency = {std::move(offsets), std::move(targets)};
+}
+
+template <concepts::Graph G>
+template <std::invocable<graphxx::Edge<G>> Weight>
+RandomWalker<G>::RandomWalker(const G &graph, Weight &&weight,
+                              size_t num_threads) {
+  std::vector<size_t> offsets(graph.num_vertices() + 1, 0);
+  std::vector<Vertex> targets;
+  std::vector<double> weights;
+  targets.reserve(graph.num_edges());
+  weights.reserve(graph.num_edges());
+  for (Vertex vertex = 0; vertex < graph.num_vertices(); ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      auto value = weight(edge);
+      if (value < 0) {
+        throw exceptions::InvariantViolationException(
+            "negative weight found");
+      }
+      if (value > 0) {
+        targets.push_back(graph.get_target(edge));
+        weights.push_back(static_cast<double>(value));
+      }
+    }
+    offsets[vertex + 1] = targets.size();
+  }
+
+  _probability.resize(targets.size());
+  _alias.resize(targets.size());
+  utils::parallel_for_chunks(
+      size_t{0}, graph.num_vertices(),
+      [&](size_t, size_t first, size_t last) {
+        std::vector<std::pair<Vertex, double>> row;
+        std::vector<size_t> small;
+        std::vector<size_t> large;
+        for (size_t vertex = first; vertex < last; ++vertex) {
+          size_t begin = offsets[vertex];
+          size_t end = offsets[vertex + 1];
+          row.clear();
+          for (size_t i = begin; i < end; ++i) {
+            row.emplace_back(targets[i], weights[i]);
+          }
+          std::sort(row.begin(), row.end());
+          for (size_t i = begin; i < end; ++i) {
+            targets[i] = row[i - begin].first;
+            weights[i] = row[i - begin].second;
+          }
+          detail::random_walks::build_alias(
+              std::span<const double>(weights.data() + begin, end - begin),
+              _probability.data() + begin, _alias.data() + begin, small,
+              large);
+        }
+      },
+      num_threads, detail::random_walks::GRAIN);
+
+  _adjacency = {std::move(offsets), std::move(targets)};
+}
+
+template <concepts::Graph G>
+RandomWalks<graphxx::Vertex<G>>
+RandomWalker<G>::walks(size_t walk_length, size_t walks_per_vertex,
+                       uint64_t seed, size_t num_threads) const {
+  return collect(walk_length, walks_per_vertex, 1, 1, seed, num_threads);
+}
+
+template <concepts::Graph G>
+template <std::invocable<size_t, std::span<const graphxx::Vertex<G>>> Sink>
+void RandomWalker<G>::walks(size_t walk_length, size_t walks_per_vertex,
+                            Sink &&sink, uint64_t seed,
+                            size_t num_threads) const {
+  generate(walk_length, walks_per_vertex, 1, 1, sink, seed, num_threads);
+}
+
+template <concepts::Graph G>
+RandomWalks<graphxx::Vertex<G>>
+RandomWalker<G>::node2vec_walks(size_t walk_length, size_t walks_per_vertex,
+                                double p, double q, uint64_t seed,
+                                size_t num_threads) const {
+  if (!(p > 0) || !(q > 0)) {
+    throw exceptions::InvariantViolationException(
+        "non positive node2vec parameter found");
+  }
+  return collect(walk_length, walks_per_vertex, p, q, seed, num_threads);
+}
+
+template <concepts::Graph G>
+template <std::invocable<size_t, std::span<const graphxx::Vertex<G>>> Sink>
+void RandomWalker<G>::node2vec_walks(size_t walk_length,
+                                     size_t walks_per_vertex, double p,
+                                     double q, Sink &&sink, uint64_t seed,
+                                     size_t num_threads) const {
+  if (!(p > 0) || !(q > 0)) {
+    throw exceptions::InvariantViolationException(
+        "non positive node2vec parameter found");
+  }
+  generate(walk_length, walks_per_vertex, p, q, sink, seed, num_threads);
+}
+
+template <concepts::Graph G>
+graphxx::Vertex<G> RandomWalker<G>::step(Vertex vertex,
+                                         utils::CounterRng &rng) const {
+  size_t first = _adjacency.offsets()[vertex];
+  size_t position = first + rng.bounded(_adjacency.degree(vertex));
+  if (!_probability.empty() && rng.uniform() >= _probability[position]) {
+    position = first + _alias[position];
+  }
+  return _adjacency.targets()[position];
+}
+
+template <concepts::Graph G>
+void RandomWalker<G>::walk_batch(size_t first, size_t last,
+                                 size_t walk_length, double p, double q,
+                                 uint64_t seed, Vertex *out,
+                                 size_t *lengths) const {
+  using detail::random_walks::BATCH;
+  size_t count = last - first;
+  if (walk_length == 0) {
+    std::fill(lengths, lengths + count, 0);
+    return;
+  }
+  bool biased = p != 1 || q != 1;
+  double max_bias = std::max({1 / p, 1.0, 1 / q});
+  double lowest_bias = std::min(1.0, 1 / q);
+  double highest_bias = std::max(1.0, 1 / q);
+
+  std::array<utils::CounterRng, BATCH> rngs;
+  std::array<Vertex, BATCH> current;
+  std::array<Vertex, BATCH> previous;
+  for (size_t i = 0; i < count; ++i) {
+    rngs[i] = utils::CounterRng(seed, first + i);
+    current[i] = static_cast<Vertex>((first + i) % _adjacency.num_vertices());
+    previous[i] = current[i];
+    out[i * walk_length] = current[i];
+    lengths[i] = 1;
+  }
+
+  for (size_t length = 1; length < walk_length; ++length) {
+    bool moved = false;
+    for (size_t i = 0; i < count; ++i) {
+      // A walk that stopped stays shorter than the current length
+      if (lengths[i] < length || _adjacency.degree(current[i]) == 0) {
+        continue;
+      }
+      Vertex next = step(current[i], rngs[i]);
+      // The first step has no previous vertex to bias against. Adjacency to
+      // the previous vertex is looked up only when the draw falls between
+      // the biases of adjacent and non adjacent vertices
+      while (biased && length > 1) {
+        double draw = rngs[i].uniform() * max_bias;
+        bool accepted;
+        if (next == previous[i]) {
+          accepted = draw < 1 / p;
+        } else if (draw < lowest_bias || draw >= highest_bias) {
+          accepted = draw < lowest_bias;
+        } else {
+          auto around = _adjacency[previous[i]];
+          accepted = draw < (std::binary_search(around.begin(), around.end(),
+                                                next)
+                                 ? 1
+                                 : 1 / q);
+        }
+        if (accepted) {
+          break;
+        }
+        next = step(current[i], rngs[i]);
+      }
+      previous[i] = current[i];
+      current[i] = next;
+      out[i * walk_length + length] = next;
+      ++lengths[i];
+      moved = true;
+    }
+    if (!moved) {
+      break;
+    }
+  }
+}
+
+template <concepts::Graph G>
+RandomWalks<graphxx::Vertex<G>>
+RandomWalker<G>::collect(size_t walk_length, size_t walks_per_vertex,
+                         double p, double q, uint64_t seed,
+                         size_t num_threads) const {
+  using detail::random_walks::BATCH;
+  size_t num_walks = walks_per_vertex * _adjacency.num_vertices();
+  RandomWalks<Vertex> result{std::vector<Vertex>(num_walks * walk_length),
+                             std::vector<size_t>(num_walks + 1, 0)};
+  auto &vertices = result.vertices;
+  auto &offsets = result.offsets;
+
+  // Every walk gets a slot of the full length
+  utils::parallel_for_chunks(
+      size_t{0}, num_walks,
+      [&](size_t, size_t first, size_t last) {
+        for (size_t index = first; index < last; index += BATCH) {
+          walk_batch(index, std::min(index + BATCH, last), walk_length, p, q,
+                     seed, vertices.data() + index * walk_length,
+                     offsets.data() + index + 1);
+        }
+      },
+      num_threads, detail::random_walks::GRAIN);
+  for (size_t index = 0; index < num_walks; ++index) {
+    offsets[index + 1] += offsets[index];
+  }
+
+  // Walks stopped early leave gaps, closed by moving every walk towards the
+  // front, never over a walk still to be moved. Walks already in place are
+  // skipped, since copy does not allow the output to start in the input
+  if (offsets.back() != vertices.size()) {
+    for (size_t index = 0; index < num_walks; ++index) {
+      if (offsets[index] == index * walk_length) {
+        continue;
+      }
+      auto slot = vertices.begin() + index * walk_length;
+      std::copy(slot, slot + (offsets[index + 1] - offsets[index]),
+                vertices.begin() + offsets[index]);
+    }
+    vertices.resize(offsets.back());
+  }
+
+  return result;
+}
+
+template <concepts::Graph G>
+template <typename Sink>
+void RandomWalker<G>::generate(size_t walk_length, size_t walks_per_vertex,
+                               double p, double q, Sink &sink, uint64_t seed,
+                               size_t num_threads) const {
+  using detail::random_walks::BATCH;
+  size_t num_walks = walks_per_vertex * _adjacency.num_vertices();
+  utils::parallel_for_chunks(
+      size_t{0}, num_walks,
+      [&](size_t, size_t first, size_t last) {
+        std::vector<Vertex> buffer(BATCH * walk_length);
+        std::array<size_t, BATCH> lengths;
+        for (size_t index = first; index < last; index += BATCH) {
+          size_t end = std::min(index + BATCH, last);
+          walk_batch(index, end, walk_length, p, q, seed, buffer.data(),
+                     lengths.data());
+          for (size_t i = 0; i < end - index; ++i) {
+            sink(index + i, std::span<const Vertex>(
+                                buffer.data() + i * walk_length, lengths[i]));
+          }
+        }
+      },
+      num_threads, detail::random_walks::GRAIN);
+}
+
+} // namespace graphxx::algorithms
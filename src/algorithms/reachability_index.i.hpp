@@ -0,0 +1,208 @@
+/**
+ * @file This file is the header implementation of the reachability index
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "algorithms/condensation.hpp"        // condensation
+#include "algorithms/parallel_scc.hpp"        // parallel_scc
+#include "algorithms/reachability_index.hpp"  // ReachabilityIndex
+#include "base.hpp"                           // Vertex
+#include "graph_concepts.hpp"                 // Graph
+#include "utils/parallel_utils.hpp"           // parallel_for
+#include "utils/random_utils.hpp"             // CounterRng
+
+#include <algorithm> // std::fill, std::min, std::shuffle
+#include <cstdint>   // size_t, uint32_t, uint64_t
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::reachability_index {
+// Buffers of the visits run by the queries of a thread. A component is
+// visited by the current query when its stamp equals the epoch, which grows
+// at every query, so the stamps are never cleared and can be shared by
+// different indices
+struct Scratch {
+  std::vector<uint32_t> stamp;
+  uint32_t epoch = 0;
+  std::vector<size_t> stack;
+
+  void start(size_t size) {
+    if (stamp.size() < size) {
+      stamp.resize(size, 0);
+    }
+    if (++epoch == 0) {
+      std::fill(stamp.begin(), stamp.end(), 0);
+      epoch = 1;
+    }
+    stack.clear();
+  }
+};
+
+inline Scratch &scratch() {
+  thread_local Scratch instance;
+  return instance;
+}
+
+// Frame of a randomized visit: the children of a component are taken
+// cyclically from a random one
+template <concepts::Identifier Id> struct Frame {
+  Id vertex;
+  size_t first;
+  size_t done;
+};
+} // namespace detail::reachability_index
+
+template <concepts::Graph G>
+ReachabilityIndex<G>::ReachabilityIndex(const G &graph, size_t num_labels,
+                                        uint64_t seed, size_t num_threads)
+    : _num_labels{num_labels} {
+  auto components = parallel_scc(graph, num_threads);
+  _condensation = condensation(graph, components).graph;
+  _component = std::move(components.component);
+
+  size_t size = num_components();
+  std::vector<bool> has_in_edges(size, false);
+  for (auto target : _condensation.targets()) {
+    has_in_edges[target] = true;
+  }
+  std::vector<Vertex> roots;
+  for (size_t c = 0; c < size; ++c) {
+    if (!has_in_edges[c]) {
+      roots.push_back(static_cast<Vertex>(c));
+    }
+  }
+
+  _labels.resize(size * _num_labels * 2);
+  utils::parallel_for(
+      size_t{0}, _num_labels,
+      [&](size_t index) { label(index, roots, seed); }, num_threads,
+      size_t{1});
+}
+
+template <concepts::Graph G>
+bool ReachabilityIndex<G>::reachable(Vertex source, Vertex target) const {
+  Vertex from = _component[source];
+  Vertex to = _component[target];
+  if (from == to) {
+    return true;
+  }
+  if (!contains(from, to)) {
+    return false;
+  }
+
+  auto &scratch = detail::reachability_index::scratch();
+  scratch.start(num_components());
+  scratch.stamp[from] = scratch.epoch;
+  scratch.stack.push_back(from);
+  while (!scratch.stack.empty()) {
+    size_t vertex = scratch.stack.back();
+    scratch.stack.pop_back();
+    for (auto child : _condensation[vertex]) {
+      if (child == to) {
+        return true;
+      }
+      if (scratch.stamp[child] != scratch.epoch) {
+        scratch.stamp[child] = scratch.epoch;
+        if (contains(child, to)) {
+          scratch.stack.push_back(child);
+        }
+      }
+    }
+  }
+  return false;
+}
+
+template <concepts::Graph G>
+bool ReachabilityIndex<G>::contains(Vertex outer, Vertex inner) const {
+  const Vertex *outer_labels = _labels.data() + outer * _num_labels * 2;
+  const Vertex *inner_labels = _labels.data() + inner * _num_labels * 2;
+  for (size_t i = 0; i < _num_labels * 2; i += 2) {
+    if (inner_labels[i] < outer_labels[i] ||
+        inner_labels[i + 1] > outer_labels[i + 1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <concepts::Graph G>
+void ReachabilityIndex<G>::label(size_t index, std::vector<Vertex> roots,
+                                 uint64_t seed) {
+  using detail::reachability_index::Frame;
+
+  utils::CounterRng rng(seed, index);
+  std::shuffle(roots.begin(), roots.end(), rng);
+
+  size_t size = num_components();
+  std::vector<Vertex> low(size);
+  std::vector<Vertex> rank(size);
+  std::vector<bool> visited(size, false);
+  std::vector<Frame<Vertex>> stack;
+  auto push = [&](Vertex vertex) {
+    visited[vertex] = true;
+    size_t degree = _condensation.degree(vertex);
+    stack.push_back({vertex, degree == 0 ? 0 : rng.bounded(degree), 0});
+  };
+
+  Vertex next_rank = 0;
+  for (Vertex root : roots) {
+    push(root);
+    while (!stack.empty()) {
+      auto [vertex, first, done] = stack.back();
+      auto children = _condensation[vertex];
+      if (done < children.size()) {
+        ++stack.back().done;
+        Vertex child = children[(first + done) % children.size()];
+        if (!visited[child]) {
+          push(child);
+        }
+        continue;
+      }
+
+      // Every child is complete, visited by this frame or earlier
+      stack.pop_back();
+      rank[vertex] = next_rank++;
+      low[vertex] = rank[vertex];
+      for (auto child : children) {
+        low[vertex] = std::min(low[vertex], low[child]);
+      }
+    }
+  }
+
+  for (size_t c = 0; c < size; ++c) {
+    _labels[(c * _num_labels + index) * 2] = low[c];
+    _labels[(c * _num_labels + index) * 2 + 1] = rank[c];
+  }
+}
+
+} // namespace graphxx::algorithms
@@ -30,75 +30,108 @@
  * @version v1.0
  */
 
+#include "algorithms/dfs.hpp"    // depth_first_visit
 #include "algorithms/tarjan.hpp" // tarjan
+#include "algorithms_base.hpp"   // DefaultVisitor
 #include "base.hpp"              // Vertex
 #include "graph_concepts.hpp"    // Graph
 
 #include <algorithm> // std::min
+#include <limits>    // std::numeric_limits
 #include <vector>    // std::vector
 
 namespace graphxx::algorithms {
 
 namespace detail::tarjan {
-template <concepts::Graph G>
-void tarjan_rec(const G &graph, Vertex<G> v, TarjanTree &tarjan_tree,
-                SCCVector<Vertex<G>> &scc_vector, StackVector<Vertex<G>> &stack,
-                int &index) {
-  tarjan_tree[v].index = index;
-  tarjan_tree[v].low_link = index;
-  ++index;
-  stack.push_back(v);
-  tarjan_tree[v].on_stack = true;
-
-  for (auto &edge : graph[v]) {
+// Visitor that maintains the Tarjan indices during the depth-first visit and
+// pops a strongly connected component whenever its root is finished
+template <concepts::Graph G> struct TarjanVisitor : DefaultVisitor {
+  const G &graph;
+  const std::vector<DfsNode<Vertex<G>>> &dfs_tree;
+  TarjanTree<Vertex<G>> &tarjan_tree;
+  SCCVector<Vertex<G>> &scc_vector;
+  StackVector<Vertex<G>> &stack;
+  Vertex<G> index = 0;
+
+  TarjanVisitor(const G &g, const std::vector<DfsNode<Vertex<G>>> &tree,
+                TarjanTree<Vertex<G>> &t_tree, SCCVector<Vertex<G>> &sccs,
+                StackVector<Vertex<G>> &s)
+      : graph{g}, dfs_tree{tree}, tarjan_tree{t_tree}, scc_vector{sccs},
+        stack{s} {}
+
+  VisitorAction discover_vertex(Vertex<G> v) {
+    tarjan_tree[v].index = index;
+    tarjan_tree[v].low_link = index;
+    ++index;
+    stack.push_back(v);
+    tarjan_tree[v].on_stack = true;
+    return VisitorAction::CONTINUE;
+  }
+
+  VisitorAction examine_edge(const Edge<G> &edge) {
     auto target = graph.get_target(edge);
-    if (tarjan_tree[target].index == -1) {
-      tarjan_rec(graph, target, tarjan_tree, scc_vector, stack, index);
-      tarjan_tree[v].low_link =
-          std::min(tarjan_tree[v].low_link, tarjan_tree[target].low_link);
-    } else if (tarjan_tree[target].on_stack) {
-      tarjan_tree[v].low_link =
-          std::min(tarjan_tree[v].low_link, tarjan_tree[target].index);
+    if (tarjan_tree[target].on_stack) {
+      auto source = graph.get_source(edge);
+      tarjan_tree[source].low_link =
+          std::min(tarjan_tree[source].low_link, tarjan_tree[target].index);
     }
+    return VisitorAction::CONTINUE;
   }
-  if (tarjan_tree[v].low_link == tarjan_tree[v].index) {
-    std::vector<Vertex<G>> new_scc;
 
-    auto w = stack.back();
-    stack.pop_back();
-    tarjan_tree[w].on_stack = false;
-    new_scc.push_back(w);
+  VisitorAction finish_vertex(Vertex<G> v) {
+    if (tarjan_tree[v].low_link == tarjan_tree[v].index) {
+      std::vector<Vertex<G>> new_scc;
 
-    while (w != v) {
-      w = stack.back();
+      auto w = stack.back();
       stack.pop_back();
       tarjan_tree[w].on_stack = false;
       new_scc.push_back(w);
+
+      while (w != v) {
+        w = stack.back();
+        stack.pop_back();
+        tarjan_tree[w].on_stack = false;
+        new_scc.push_back(w);
+      }
+
+      scc_vector.push_back(new_scc);
     }
 
-    scc_vector.push_back(new_scc);
+    // Propagates the low link to the parent, as the recursive formulation
+    // does when returning from the call on a tree edge
+    auto parent = dfs_tree[v].parent;
+    if (parent != INVALID_VERTEX<G>) {
+      tarjan_tree[parent].low_link =
+          std::min(tarjan_tree[parent].low_link, tarjan_tree[v].low_link);
+    }
+    return VisitorAction::CONTINUE;
   }
-}
+};
 } // namespace detail::tarjan
 
 template <concepts::Graph G> SCCVector<Vertex<G>> tarjan(const G &graph) {
+  using NodeType = TarjanNode<Vertex<G>>;
+  constexpr auto unset_index = std::numeric_limits<Vertex<G>>::max();
 
   SCCVector<Vertex<G>> scc_vector;
-  TarjanTree tarjan_tree;
+  TarjanTree<Vertex<G>> tarjan_tree(
+      graph.num_vertices(),
+      NodeType{
+          .index = unset_index, .low_link = unset_index, .on_stack = false});
   StackVector<Vertex<G>> stack;
-  int index = 0;
 
-  for (Vertex<G> vertex = 0; vertex < graph.num_vertices(); vertex++) {
-    tarjan_tree.push_back(
-        TarjanNode{.index = -1, .low_link = -1, .on_stack = false});
-  }
+  auto dfs_tree = detail::dfs::make_distance_tree(graph);
+  DfsStack<G> dfs_stack;
+  Vertex<G> time = 0;
+
+  detail::tarjan::TarjanVisitor<G> visitor{graph, dfs_tree, tarjan_tree,
+                                           scc_vector, stack};
 
   for (Vertex<G> vertex = 0; vertex < graph.num_vertices(); vertex++) {
-    if (tarjan_tree[vertex].index != -1) {
+    if (tarjan_tree[vertex].index != unset_index) {
       continue;
     }
-    detail::tarjan::tarjan_rec(graph, vertex, tarjan_tree, scc_vector, stack,
-                               index);
+    depth_first_visit(graph, vertex, visitor, dfs_tree, time, dfs_stack);
   }
 
   return scc_vector;
@@ -0,0 +1,137 @@
+/**
+ * @file This file is the header implementation of the topological sort algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // make_csr
+#include "algorithms/topological_sort.hpp"    // topological_sort
+#include "base.hpp"                           // Vertex
+#include "exceptions.hpp"                     // InvariantViolationException
+#include "graph_concepts.hpp"                 // Graph
+#include "utils/parallel_utils.hpp"           // parallel_collect
+
+#include <atomic>  // std::atomic_ref
+#include <cstdint> // size_t
+#include <vector>  // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::topological_sort {
+// Number of vertices assigned to a thread at a time
+constexpr size_t GRAIN = 256;
+} // namespace detail::topological_sort
+
+template <concepts::Graph G>
+std::vector<Vertex<G>> topological_sort(const G &graph) {
+  size_t size = graph.num_vertices();
+  std::vector<size_t> in_degree(size, 0);
+  for (Vertex<G> vertex = 0; vertex < size; ++vertex) {
+    for (auto &&edge : graph[vertex]) {
+      ++in_degree[graph.get_target(edge)];
+    }
+  }
+
+  // The output itself is the queue of the vertices without in edges
+  std::vector<Vertex<G>> order;
+  order.reserve(size);
+  for (Vertex<G> vertex = 0; vertex < size; ++vertex) {
+    if (in_degree[vertex] == 0) {
+      order.push_back(vertex);
+    }
+  }
+
+  for (size_t next = 0; next < order.size(); ++next) {
+    for (auto &&edge : graph[order[next]]) {
+      Vertex<G> target = graph.get_target(edge);
+      if (--in_degree[target] == 0) {
+        order.push_back(target);
+      }
+    }
+  }
+
+  if (order.size() < size) {
+    throw exceptions::InvariantViolationException("cycle found");
+  }
+
+  return order;
+}
+
+template <concepts::Graph G>
+TopologicalLevels<Vertex<G>> topological_levels(const G &graph,
+                                                size_t num_threads) {
+  using Id = Vertex<G>;
+  using detail::topological_sort::GRAIN;
+
+  size_t size = graph.num_vertices();
+  auto csr = make_csr(graph);
+  std::vector<size_t> in_degree(size, 0);
+  for (auto target : csr.targets()) {
+    ++in_degree[target];
+  }
+
+  TopologicalLevels<Id> levels;
+  levels.order.reserve(size);
+  levels.offsets.push_back(0);
+
+  auto frontier = utils::parallel_collect<Id>(
+      size_t{0}, size,
+      [&](size_t vertex, std::vector<Id> &output) {
+        if (in_degree[vertex] == 0) {
+          output.push_back(static_cast<Id>(vertex));
+        }
+      },
+      num_threads);
+
+  while (!frontier.empty()) {
+    levels.order.insert(levels.order.end(), frontier.begin(), frontier.end());
+    levels.offsets.push_back(levels.order.size());
+
+    frontier = utils::parallel_collect<Id>(
+        size_t{0}, frontier.size(),
+        [&](size_t index, std::vector<Id> &output) {
+          for (auto target : csr[frontier[index]]) {
+            // Only the last in edge removed collects the target
+            if (std::atomic_ref<size_t>(in_degree[target])
+                    .fetch_sub(1, std::memory_order_relaxed) == 1) {
+              output.push_back(target);
+            }
+          }
+        },
+        num_threads, GRAIN);
+  }
+
+  if (levels.order.size() < size) {
+    throw exceptions::InvariantViolationException("cycle found");
+  }
+
+  return levels;
+}
+
+} // namespace graphxx::algorithms
@@ -0,0 +1,176 @@
+/**
+ * @file This file is the header implementation of the transitive closure algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // CompressedSparseRow
+#include "algorithms/condensation.hpp"        // condensation
+#include "algorithms/parallel_scc.hpp"        // parallel_scc
+#include "algorithms/transitive_closure.hpp"  // transitive_closure
+#include "base.hpp"                           // Vertex
+#include "graph_concepts.hpp"                 // Graph
+#include "utils/parallel_utils.hpp"           // parallel_for_chunks
+#include "utils/simd_utils.hpp"               // or_into
+
+#include <algorithm> // std::sort, std::max
+#include <cstdint>   // size_t, uint64_t
+#include <span>      // std::span
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::transitive_closure {
+// Number of components assigned to a thread at a time
+constexpr size_t GRAIN = 64;
+
+// Components of a directed acyclic graph sorted by increasing height, with
+// the height of every component
+template <concepts::Identifier Id> struct Heights {
+  std::vector<size_t> height;
+  std::vector<Id> order;
+  // The components of height h are order[offsets[h]] up to
+  // order[offsets[h + 1]]
+  std::vector<size_t> offsets;
+};
+
+// Kahn order of the components, then heights in reverse order and a counting
+// sort of the components by height
+template <concepts::Identifier Id>
+Heights<Id> heights(const CompressedSparseRow<Id> &dag) {
+  size_t size = dag.num_vertices();
+  std::vector<size_t> in_degree(size, 0);
+  for (auto target : dag.targets()) {
+    ++in_degree[target];
+  }
+  std::vector<Id> topological;
+  topological.reserve(size);
+  for (size_t c = 0; c < size; ++c) {
+    if (in_degree[c] == 0) {
+      topological.push_back(static_cast<Id>(c));
+    }
+  }
+  for (size_t next = 0; next < topological.size(); ++next) {
+    for (auto target : dag[topological[next]]) {
+      if (--in_degree[target] == 0) {
+        topological.push_back(target);
+      }
+    }
+  }
+
+  Heights<Id> result;
+  result.height.assign(size, 0);
+  size_t max_height = 0;
+  for (size_t i = size; i-- > 0;) {
+    Id c = topological[i];
+    for (auto target : dag[c]) {
+      result.height[c] = std::max(result.height[c], result.height[target] + 1);
+    }
+    max_height = std::max(max_height, result.height[c]);
+  }
+
+  result.offsets.assign(size == 0 ? 1 : max_height + 2, 0);
+  for (size_t c = 0; c < size; ++c) {
+    ++result.offsets[result.height[c] + 1];
+  }
+  for (size_t h = 1; h < result.offsets.size(); ++h) {
+    result.offsets[h] += result.offsets[h - 1];
+  }
+  result.order.resize(size);
+  std::vector<size_t> next(result.offsets.begin(), result.offsets.end() - 1);
+  for (size_t c = 0; c < size; ++c) {
+    result.order[next[result.height[c]]++] = static_cast<Id>(c);
+  }
+  return result;
+}
+
+// Reachability bitsets of the components of a directed acyclic graph. The
+// successors of a component have a smaller height, so their bitsets are
+// complete when it is processed
+template <concepts::Identifier Id>
+std::vector<uint64_t> close(const CompressedSparseRow<Id> &dag,
+                            size_t words_per_row, size_t num_threads) {
+  auto [height, order, offsets] = heights(dag);
+  std::vector<uint64_t> bits(dag.num_vertices() * words_per_row, 0);
+
+  for (size_t h = 0; h + 1 < offsets.size(); ++h) {
+    utils::parallel_for_chunks(
+        offsets[h], offsets[h + 1],
+        [&](size_t, size_t first, size_t last) {
+          std::vector<Id> successors;
+          for (size_t i = first; i < last; ++i) {
+            Id c = order[i];
+            std::span<uint64_t> row(bits.data() + c * words_per_row,
+                                    words_per_row);
+            row[c / 64] |= uint64_t{1} << (c % 64);
+
+            // Higher successors are more likely to reach the lower ones
+            successors.assign(dag[c].begin(), dag[c].end());
+            std::sort(
+                successors.begin(), successors.end(),
+                [&](Id lhs, Id rhs) { return height[lhs] > height[rhs]; });
+            for (Id successor : successors) {
+              if ((row[successor / 64] >> (successor % 64)) & 1) {
+                continue;
+              }
+              utils::or_into(row, std::span<const uint64_t>(
+                                      bits.data() + successor * words_per_row,
+                                      words_per_row));
+            }
+          }
+        },
+        num_threads, GRAIN);
+  }
+  return bits;
+}
+} // namespace detail::transitive_closure
+
+template <concepts::Graph G>
+TransitiveClosure<Vertex<G>> transitive_closure(const G &graph,
+                                                size_t num_threads) {
+  return transitive_closure(graph, parallel_scc(graph, num_threads),
+                            num_threads);
+}
+
+template <concepts::Graph G>
+TransitiveClosure<Vertex<G>>
+transitive_closure(const G &graph, const SCCComponents<Vertex<G>> &components,
+                   size_t num_threads) {
+  TransitiveClosure<Vertex<G>> closure;
+  closure.component = components.component;
+  closure.num_components = components.sizes.size();
+  closure.words_per_row = (closure.num_components + 63) / 64;
+  closure.bits = detail::transitive_closure::close(
+      condensation(graph, components).graph, closure.words_per_row,
+      num_threads);
+  return closure;
+}
+
+} // namespace graphxx::algorithms
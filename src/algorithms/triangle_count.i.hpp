@@ -0,0 +1,203 @@
+/**
+ * @file This file is the header implementation of the triangle counting algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp" // make_symmetric_csr
+#include "algorithms/triangle_count.hpp"      // triangle_count
+#include "graph_concepts.hpp"                 // Graph, Identifier
+#include "utils/parallel_utils.hpp"           // parallel_for_chunks
+#include "utils/simd_utils.hpp"               // intersection_size
+
+#include <atomic>  // std::atomic, std::atomic_ref
+#include <cstdint> // size_t
+#include <utility> // std::move
+#include <vector>  // std::vector
+
+namespace graphxx::algorithms {
+
+namespace detail::triangle_count {
+// Number of vertices assigned to a thread at a time, kept small since the
+// work per vertex is very uneven
+constexpr size_t GRAIN = 256;
+
+// Keeps the neighbours following a vertex in the (degree, id) order,
+// preserving the sorting of the lists
+template <concepts::Identifier Id>
+CompressedSparseRow<Id> orient(const CompressedSparseRow<Id> &symmetric,
+                               size_t num_threads) {
+  size_t size = symmetric.num_vertices();
+  auto precedes = [&](Id lhs, Id rhs) {
+    size_t lhs_degree = symmetric.degree(lhs);
+    size_t rhs_degree = symmetric.degree(rhs);
+    return lhs_degree < rhs_degree || (lhs_degree == rhs_degree && lhs < rhs);
+  };
+
+  std::vector<size_t> offsets(size + 1, 0);
+  utils::parallel_for(
+      size_t{0}, size,
+      [&](size_t index) {
+        auto vertex = static_cast<Id>(index);
+        for (auto neighbour : symmetric[vertex]) {
+          offsets[index + 1] += precedes(vertex, neighbour);
+        }
+      },
+      num_threads);
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    offsets[vertex + 1] += offsets[vertex];
+  }
+
+  std::vector<Id> targets(offsets.back());
+  utils::parallel_for(
+      size_t{0}, size,
+      [&](size_t index) {
+        auto vertex = static_cast<Id>(index);
+        size_t position = offsets[index];
+        for (auto neighbour : symmetric[vertex]) {
+          if (precedes(vertex, neighbour)) {
+            targets[position++] = neighbour;
+          }
+        }
+      },
+      num_threads);
+
+  return {std::move(offsets), std::move(targets)};
+}
+} // namespace detail::triangle_count
+
+template <concepts::Identifier Id>
+size_t triangle_count(const CompressedSparseRow<Id> &symmetric,
+                      size_t num_threads) {
+  auto oriented = detail::triangle_count::orient(symmetric, num_threads);
+
+  std::atomic<size_t> triangles = 0;
+  utils::parallel_for_chunks(
+      size_t{0}, oriented.num_vertices(),
+      [&](size_t, size_t first, size_t last) {
+        size_t count = 0;
+        for (size_t index = first; index < last; ++index) {
+          auto neighbours = oriented[static_cast<Id>(index)];
+          for (auto neighbour : neighbours) {
+            count += utils::intersection_size(neighbours, oriented[neighbour]);
+          }
+        }
+        triangles += count;
+      },
+      num_threads, detail::triangle_count::GRAIN);
+
+  return triangles;
+}
+
+template <concepts::Graph G>
+size_t triangle_count(const G &graph, size_t num_threads) {
+  return triangle_count(make_symmetric_csr(graph, num_threads), num_threads);
+}
+
+template <concepts::Identifier Id>
+std::vector<size_t>
+vertex_triangle_counts(const CompressedSparseRow<Id> &symmetric,
+                       size_t num_threads) {
+  auto oriented = detail::triangle_count::orient(symmetric, num_threads);
+  std::vector<size_t> counts(oriented.num_vertices(), 0);
+  auto add = [&](Id vertex, size_t count) {
+    std::atomic_ref<size_t>(counts[vertex])
+        .fetch_add(count, std::memory_order_relaxed);
+  };
+
+  utils::parallel_for_chunks(
+      size_t{0}, oriented.num_vertices(),
+      [&](size_t, size_t first, size_t last) {
+        std::vector<Id> common;
+        for (size_t index = first; index < last; ++index) {
+          auto vertex = static_cast<Id>(index);
+          auto neighbours = oriented[vertex];
+          common.resize(neighbours.size());
+          size_t count = 0;
+          for (auto neighbour : neighbours) {
+            // Every common neighbour closes a triangle with this edge
+            size_t closing = utils::intersection(
+                neighbours, oriented[neighbour], common.data());
+            for (size_t i = 0; i < closing; ++i) {
+              add(common[i], 1);
+            }
+            if (closing > 0) {
+              add(neighbour, closing);
+            }
+            count += closing;
+          }
+          if (count > 0) {
+            add(vertex, count);
+          }
+        }
+      },
+      num_threads, detail::triangle_count::GRAIN);
+
+  // Every thread has been joined, so the plain reads are ordered
+  return counts;
+}
+
+template <concepts::Graph G>
+std::vector<size_t> vertex_triangle_counts(const G &graph,
+                                           size_t num_threads) {
+  return vertex_triangle_counts(make_symmetric_csr(graph, num_threads),
+                                num_threads);
+}
+
+template <concepts::Identifier Id>
+std::vector<double>
+clustering_coefficients(const CompressedSparseRow<Id> &symmetric,
+                        size_t num_threads) {
+  auto triangles = vertex_triangle_counts(symmetric, num_threads);
+
+  std::vector<double> coefficients(triangles.size(), 0);
+  utils::parallel_for(
+      size_t{0}, triangles.size(),
+      [&](size_t vertex) {
+        auto degree =
+            static_cast<double>(symmetric.degree(static_cast<Id>(vertex)));
+        if (degree > 1) {
+          coefficients[vertex] =
+              2 * static_cast<double>(triangles[vertex]) /
+              (degree * (degree - 1));
+        }
+      },
+      num_threads);
+
+  return coefficients;
+}
+
+template <concepts::Graph G>
+std::vector<double> clustering_coefficients(const G &graph,
+                                            size_t num_threads) {
+  return clustering_coefficients(make_symmetric_csr(graph, num_threads),
+                                 num_threads);
+}
+
+} // namespace graphxx::algorithms
@@ -37,6 +37,7 @@
 #include "matrix_graph.hpp"
 
 #include <cstdint>
+#include <limits>
 
 namespace bellman_ford_test {
 using namespace graphxx;
@@ -152,6 +153,23 @@ TEST_CASE("Bellman ford shortest paths for directed list graph",
     REQUIRE(distances[d].parent == a);
     REQUIRE(distances[e].parent == d);
   }
+
+  SECTION("ignores negative edges leaving unreachable vertices") {
+    for (size_t vertex = 0; vertex < graph.num_vertices(); vertex++) {
+      auto out_edge_list = graph[vertex];
+      for (auto edge : out_edge_list) {
+        graph.set_attributes(graph.get_source(edge), graph.get_target(edge),
+                             {1});
+      }
+    }
+
+    graph.set_attributes(a, d, {-1});
+
+    auto distances = bellman_ford(graph, b);
+
+    REQUIRE(distances[e].distance == 2);
+    REQUIRE(distances[d].distance == std::numeric_limits<int>::max());
+  }
 }
 
 TEST_CASE("Bellman ford shortest paths for directed matrix graph",
@@ -0,0 +1,248 @@
+/**
+ * @file This file is the test file of the betweenness centrality algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "betweenness.hpp"
+#include "catch.hpp"
+#include "exceptions.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace betweenness_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+// Betweenness from the number of shortest paths between all the pairs,
+// computed with a naive Dijkstra from every source
+template <typename G, typename Weight>
+std::vector<double> expected_centrality(const G &graph, Weight weight) {
+  size_t size = graph.num_vertices();
+  const long unreached = std::numeric_limits<long>::max();
+  std::vector<std::vector<long>> distance(size,
+                                          std::vector<long>(size, unreached));
+  std::vector<std::vector<double>> paths(size, std::vector<double>(size, 0));
+
+  for (unsigned long s = 0; s < size; ++s) {
+    std::vector<bool> settled(size, false);
+    distance[s][s] = 0;
+    paths[s][s] = 1;
+    while (true) {
+      unsigned long u = size;
+      for (unsigned long v = 0; v < size; ++v) {
+        if (!settled[v] && distance[s][v] != unreached &&
+            (u == size || distance[s][v] < distance[s][u])) {
+          u = v;
+        }
+      }
+      if (u == size) {
+        break;
+      }
+      settled[u] = true;
+      for (auto &edge : graph[u]) {
+        auto v = graph.get_target(edge);
+        long alternative = distance[s][u] + weight(edge);
+        if (alternative < distance[s][v]) {
+          distance[s][v] = alternative;
+          paths[s][v] = paths[s][u];
+        } else if (alternative == distance[s][v]) {
+          paths[s][v] += paths[s][u];
+        }
+      }
+    }
+  }
+
+  std::vector<double> centrality(size, 0);
+  for (unsigned long s = 0; s < size; ++s) {
+    for (unsigned long t = 0; t < size; ++t) {
+      if (s == t || distance[s][t] == unreached) {
+        continue;
+      }
+      for (unsigned long v = 0; v < size; ++v) {
+        if (v != s && v != t && distance[s][v] != unreached &&
+            distance[v][t] != unreached &&
+            distance[s][v] + distance[v][t] == distance[s][t]) {
+          centrality[v] += paths[s][v] * paths[v][t] / paths[s][t];
+        }
+      }
+    }
+  }
+  if (G::DIRECTEDNESS == Directedness::UNDIRECTED) {
+    for (auto &value : centrality) {
+      value /= 2;
+    }
+  }
+  return centrality;
+}
+
+TEST_CASE("Betweenness centrality for undirected list graph",
+          "[betweenness][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 3);
+  graph.add_edge(3, 4);
+
+  SECTION("counts the pairs whose paths cross a vertex") {
+    auto centrality = betweenness_centrality(graph, 2);
+
+    REQUIRE(centrality == std::vector<double>{0, 3, 4, 3, 0});
+  }
+
+  SECTION("splits the dependency among equal shortest paths") {
+    graph.add_edge(0, 5);
+    graph.add_edge(5, 2);
+
+    auto centrality = betweenness_centrality(graph);
+
+    REQUIRE(centrality[1] == Approx(1.5));
+    REQUIRE(centrality[5] == Approx(1.5));
+    REQUIRE(centrality[2] == Approx(6.5));
+  }
+}
+
+TEST_CASE("Betweenness centrality for weighted directed matrix graph",
+          "[betweenness][matrix_graph][directed]") {
+  using Graph =
+      AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED, int>;
+  Graph graph{};
+
+  graph.add_edge(0, 1, {1});
+  graph.add_edge(1, 3, {1});
+  graph.add_edge(0, 2, {2});
+  graph.add_edge(2, 3, {1});
+  graph.add_edge(3, 4, {1});
+
+  SECTION("follows the lightest paths") {
+    auto centrality = weighted_betweenness_centrality(graph);
+
+    REQUIRE(centrality == std::vector<double>{0, 2, 0, 3, 0});
+  }
+
+  SECTION("rejects non positive weights") {
+    graph.add_edge(4, 0, {0});
+
+    REQUIRE_THROWS_AS(weighted_betweenness_centrality(graph),
+                      exceptions::InvariantViolationException);
+  }
+}
+
+TEST_CASE("Betweenness centrality for random graphs",
+          "[betweenness][list_graph]") {
+  const unsigned long num_vertices = 60;
+  std::mt19937 generator(40);
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+  std::uniform_int_distribution<int> weights(1, 3);
+
+  auto require_close = [](const std::vector<double> &actual,
+                          const std::vector<double> &expected) {
+    REQUIRE(actual.size() == expected.size());
+    for (size_t v = 0; v < actual.size(); ++v) {
+      REQUIRE(actual[v] == Approx(expected[v]).margin(1e-9));
+    }
+  };
+
+  SECTION("unweighted directed graph") {
+    AdjacencyListGraph<unsigned long, Directedness::DIRECTED> graph{};
+    graph.add_vertex(num_vertices - 1);
+    for (size_t i = 0; i < 150; ++i) {
+      graph.add_edge(pick(generator), pick(generator));
+    }
+
+    require_close(betweenness_centrality(graph, 4),
+                  expected_centrality(graph, [](const auto &) { return 1; }));
+  }
+
+  SECTION("weighted undirected graph") {
+    AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED, int> graph{};
+    graph.add_vertex(num_vertices - 1);
+    for (size_t i = 0; i < 120; ++i) {
+      auto u = pick(generator);
+      auto v = pick(generator);
+      if (u != v) {
+        graph.add_edge(u, v, {weights(generator)});
+      }
+    }
+
+    auto weight = [](const auto &edge) { return std::get<2>(edge); };
+
+    require_close(weighted_betweenness_centrality(graph, weight, 4),
+                  expected_centrality(graph, weight));
+  }
+}
+
+TEST_CASE("Approximate betweenness centrality",
+          "[betweenness][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  const unsigned long num_vertices = 1000;
+  std::mt19937 generator(40);
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+
+  Graph graph{};
+  graph.add_vertex(num_vertices - 1);
+  for (size_t i = 0; i < 3000; ++i) {
+    graph.add_edge(pick(generator), pick(generator));
+  }
+  auto exact = betweenness_centrality(graph, 4);
+
+  SECTION("is exact when every vertex is sampled") {
+    auto approximate =
+        approximate_betweenness_centrality(graph, num_vertices, 7, 4);
+
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      REQUIRE(approximate[v] == Approx(exact[v]));
+    }
+  }
+
+  SECTION("stays within the error bound of the sample size") {
+    double epsilon = 0.1;
+    size_t num_samples = betweenness_sample_size(num_vertices, epsilon, 0.1);
+    REQUIRE(num_samples < num_vertices);
+
+    auto approximate =
+        approximate_betweenness_centrality(graph, num_samples, 7, 4);
+
+    double bound = epsilon * num_vertices * (num_vertices - 2);
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      REQUIRE(std::abs(approximate[v] - exact[v]) < bound);
+    }
+  }
+}
+
+} // namespace betweenness_test
@@ -359,4 +359,107 @@ TEST_CASE("BFS Tree correct visited order for undirected matrix graph",
     }
   }
 }
+
+TEST_CASE("BFS driven by a visitor", "[BFS][list_graph][visitor]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d, e };
+
+  graph.add_edge(a, b); // 0->1
+  graph.add_edge(a, c); // 0->2
+  graph.add_edge(a, d); // 0->3
+  graph.add_edge(b, c); // 1->2
+  graph.add_edge(d, e); // 3->4
+
+  /*
+    A--->B--->C
+    --------->
+    |
+    |
+    ---->D--->E
+  */
+
+  SECTION("stops as soon as the searched vertex is discovered") {
+    struct FindVisitor : DefaultVisitor {
+      Graph::Vertex target;
+      size_t discovered = 0;
+
+      VisitorAction discover_vertex(Graph::Vertex vertex) {
+        ++discovered;
+        return vertex == target ? VisitorAction::STOP
+                                : VisitorAction::CONTINUE;
+      }
+    };
+
+    FindVisitor visitor{};
+    visitor.target = c;
+    auto tree = bfs(graph, a, visitor);
+
+    REQUIRE(visitor.discovered == 3);
+    REQUIRE(tree[c].parent == a);
+    REQUIRE(tree[c].distance == 1);
+    REQUIRE(tree[d].status == VertexStatus::READY);
+    REQUIRE(tree[e].status == VertexStatus::READY);
+  }
+
+  SECTION("skipped vertices are not expanded") {
+    struct SkipVisitor : DefaultVisitor {
+      VisitorAction discover_vertex(Graph::Vertex vertex) {
+        return vertex == d ? VisitorAction::SKIP : VisitorAction::CONTINUE;
+      }
+    };
+
+    auto tree = bfs(graph, a, SkipVisitor{});
+
+    REQUIRE(tree[d].status == VertexStatus::PROCESSED);
+    REQUIRE(tree[d].distance == 1);
+    REQUIRE(tree[e].status == VertexStatus::READY);
+  }
+
+  SECTION("skipped edges are not followed") {
+    struct SkipEdgeVisitor : DefaultVisitor {
+      VisitorAction examine_edge(const Graph::Edge &edge) {
+        return std::get<1>(edge) == c ? VisitorAction::SKIP
+                                      : VisitorAction::CONTINUE;
+      }
+    };
+
+    auto tree = bfs(graph, a, SkipEdgeVisitor{});
+
+    REQUIRE(tree[c].status == VertexStatus::READY);
+    REQUIRE(tree[e].distance == 2);
+  }
+
+  SECTION("every event is notified") {
+    struct CountingVisitor {
+      size_t discovered = 0, examined = 0, tree_edges = 0, finished = 0;
+
+      VisitorAction discover_vertex(Graph::Vertex) {
+        ++discovered;
+        return VisitorAction::CONTINUE;
+      }
+      VisitorAction examine_edge(const Graph::Edge &) {
+        ++examined;
+        return VisitorAction::CONTINUE;
+      }
+      VisitorAction tree_edge(const Graph::Edge &) {
+        ++tree_edges;
+        return VisitorAction::CONTINUE;
+      }
+      VisitorAction finish_vertex(Graph::Vertex) {
+        ++finished;
+        return VisitorAction::CONTINUE;
+      }
+    };
+
+    CountingVisitor visitor{};
+    bfs(graph, a, visitor);
+
+    REQUIRE(visitor.discovered == 5);
+    REQUIRE(visitor.examined == 5);
+    REQUIRE(visitor.tree_edges == 4);
+    REQUIRE(visitor.finished == 5);
+  }
+}
 } // namespace bfs_test
\ No newline at end of file
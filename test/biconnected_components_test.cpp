@@ -0,0 +1,257 @@
+/**
+ * @file This file is the test file of the biconnected components algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp"
+#include "base.hpp"
+#include "biconnected_components.hpp"
+#include "catch.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <map>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace biconnected_components_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+using EdgeKey = std::pair<unsigned long, unsigned long>;
+
+EdgeKey key(unsigned long u, unsigned long v) {
+  return u < v ? EdgeKey{u, v} : EdgeKey{v, u};
+}
+
+// Components and bridges of the edges, checking that both entries agree
+template <typename G>
+std::map<EdgeKey, std::pair<size_t, bool>>
+by_edge(const G &graph, const BiconnectedComponents &result) {
+  std::map<EdgeKey, std::pair<size_t, bool>> edges;
+  size_t position = 0;
+  for (unsigned long v = 0; v < graph.num_vertices(); ++v) {
+    for (auto &&edge : graph[v]) {
+      auto u = graph.get_target(edge);
+      std::pair value{result.edge_component[position],
+                      static_cast<bool>(result.bridge[position])};
+      auto it = edges.emplace(key(u, v), value).first;
+      REQUIRE(it->second == value);
+      ++position;
+    }
+  }
+  return edges;
+}
+
+// Number of connected components among the vertices not removed, ignoring
+// one edge
+size_t count_components(const CompressedSparseRow<unsigned long> &csr,
+                        unsigned long removed_vertex, EdgeKey removed) {
+  size_t size = csr.num_vertices();
+  std::vector<bool> seen(size, false);
+  size_t count = 0;
+  for (unsigned long root = 0; root < size; ++root) {
+    if (seen[root] || root == removed_vertex) {
+      continue;
+    }
+    ++count;
+    std::vector<unsigned long> stack{root};
+    seen[root] = true;
+    while (!stack.empty()) {
+      auto v = stack.back();
+      stack.pop_back();
+      for (auto u : csr[v]) {
+        if (!seen[u] && u != removed_vertex &&
+            key(u, v) != removed) {
+          seen[u] = true;
+          stack.push_back(u);
+        }
+      }
+    }
+  }
+  return count;
+}
+
+TEST_CASE("Biconnected components for undirected list graph",
+          "[biconnected_components][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  // Two triangles sharing vertex 2, then a path 4 - 5 - 6 and a self loop
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 0);
+  graph.add_edge(2, 3);
+  graph.add_edge(3, 4);
+  graph.add_edge(4, 2);
+  graph.add_edge(4, 5);
+  graph.add_edge(5, 6);
+  graph.add_edge(6, 6);
+  graph.add_vertex(7);
+
+  auto result = biconnected_components(graph);
+  auto edges = by_edge(graph, result);
+
+  SECTION("articulation points") {
+    REQUIRE(result.articulation_point ==
+            std::vector<bool>{false, false, true, false, true, true, false,
+                              false});
+  }
+
+  SECTION("components and bridges") {
+    REQUIRE(result.num_components == 4);
+    auto first = edges[{0, 1}].first;
+    REQUIRE(edges[{1, 2}].first == first);
+    REQUIRE(edges[{0, 2}].first == first);
+    auto second = edges[{2, 3}].first;
+    REQUIRE(edges[{3, 4}].first == second);
+    REQUIRE(edges[{2, 4}].first == second);
+    REQUIRE(std::set<size_t>{first, second, edges[{4, 5}].first,
+                             edges[{5, 6}].first}
+                .size() == 4);
+    REQUIRE(edges[{6, 6}].first == BiconnectedComponents::NO_COMPONENT);
+
+    for (auto &[edge, value] : edges) {
+      bool bridge = edge == EdgeKey{4, 5} || edge == EdgeKey{5, 6};
+      REQUIRE(value.second == bridge);
+    }
+  }
+}
+
+TEST_CASE("Biconnected components for undirected matrix graph",
+          "[biconnected_components][matrix_graph][undirected]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  // A cycle has a single component and no cut vertex
+  for (unsigned long v = 0; v < 5; ++v) {
+    graph.add_edge(v, (v + 1) % 5);
+  }
+
+  SECTION("cycle") {
+    auto result = biconnected_components(graph);
+
+    REQUIRE(result.num_components == 1);
+    REQUIRE(result.articulation_point == std::vector<bool>(5, false));
+    REQUIRE(result.bridge == std::vector<bool>(10, false));
+  }
+}
+
+TEST_CASE("Biconnected components of a compressed sparse row",
+          "[biconnected_components][compressed_sparse_row]") {
+  SECTION("parallel edges are not bridges") {
+    // 0 = 1 - 2, with the edge between 0 and 1 doubled
+    CompressedSparseRow<unsigned long> csr({0, 2, 5, 6}, {1, 1, 0, 0, 2, 1});
+    auto result = biconnected_components(csr);
+
+    REQUIRE(result.num_components == 2);
+    REQUIRE(result.bridge ==
+            std::vector<bool>{false, false, false, false, true, true});
+    REQUIRE(result.articulation_point ==
+            std::vector<bool>{false, true, false});
+  }
+
+  SECTION("deep paths do not overflow the call stack") {
+    const unsigned long size = 1000000;
+    std::vector<size_t> offsets(size + 1, 0);
+    std::vector<unsigned long> targets;
+    for (unsigned long v = 0; v < size; ++v) {
+      if (v > 0) {
+        targets.push_back(v - 1);
+      }
+      if (v + 1 < size) {
+        targets.push_back(v + 1);
+      }
+      offsets[v + 1] = targets.size();
+    }
+    auto result = biconnected_components(
+        CompressedSparseRow<unsigned long>(offsets, targets));
+
+    REQUIRE(result.num_components == size - 1);
+    REQUIRE(!result.articulation_point.front());
+    REQUIRE(result.articulation_point[size / 2]);
+  }
+}
+
+TEST_CASE("Biconnected components for random graphs",
+          "[biconnected_components][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  const unsigned long num_vertices = 40;
+  std::mt19937 generator(48);
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+
+  SECTION("agree with removing every vertex and edge") {
+    for (int round = 0; round < 10; ++round) {
+      Graph graph{};
+      graph.add_vertex(num_vertices - 1);
+      for (size_t i = 0; i < 50; ++i) {
+        graph.add_edge(pick(generator), pick(generator));
+      }
+      auto csr = make_csr(graph);
+      auto result = biconnected_components(graph);
+      auto edges = by_edge(graph, result);
+      const EdgeKey none{num_vertices, num_vertices};
+      size_t base = count_components(csr, num_vertices, none);
+
+      for (unsigned long v = 0; v < num_vertices; ++v) {
+        // Isolated vertices disappear, cut vertices split their component
+        bool isolated = csr.degree(v) == 0 ||
+                        (csr.degree(v) == 1 && csr[v][0] == v);
+        size_t expected = base - (isolated ? 1 : 0);
+        REQUIRE(result.articulation_point[v] ==
+                (count_components(csr, v, none) > expected));
+
+        // A vertex is a cut vertex when its edges span several components
+        std::set<size_t> incident;
+        for (auto u : csr[v]) {
+          if (u != v) {
+            incident.insert(edges[key(u, v)].first);
+          }
+        }
+        REQUIRE(result.articulation_point[v] == (incident.size() > 1));
+      }
+
+      std::set<size_t> components;
+      for (auto &[edge, value] : edges) {
+        if (edge.first == edge.second) {
+          continue;
+        }
+        components.insert(value.first);
+        REQUIRE(value.second ==
+                (count_components(csr, num_vertices, edge) > base));
+      }
+      REQUIRE(components.size() == result.num_components);
+    }
+  }
+}
+
+} // namespace biconnected_components_test
@@ -0,0 +1,162 @@
+/**
+ * @file This file is the test file of the parallel Boruvka algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "boruvka.hpp"
+#include "catch.hpp"
+#include "kruskal.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <random>
+
+namespace boruvka_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+TEST_CASE("Boruvka minimum spanning tree for directed list graph",
+          "[boruvka][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d };
+
+  graph.add_edge(a, b, {2});
+  graph.add_edge(a, c, {1});
+  graph.add_edge(a, d, {4});
+  graph.add_edge(b, a, {2});
+  graph.add_edge(b, c, {3});
+  graph.add_edge(c, a, {1});
+  graph.add_edge(c, d, {9});
+  graph.add_edge(d, a, {4});
+
+  SECTION("check if edges founded are correct") {
+    auto vector = boruvka(
+        graph, [](const auto &edge) { return std::get<2>(edge); }, 2);
+
+    REQUIRE(vector.size() == 3);
+    REQUIRE(graph.get_source(vector[0]) == a);
+    REQUIRE(graph.get_target(vector[0]) == c);
+    REQUIRE(graph.get_source(vector[1]) == a);
+    REQUIRE(graph.get_target(vector[1]) == b);
+    REQUIRE(graph.get_source(vector[2]) == a);
+    REQUIRE(graph.get_target(vector[2]) == d);
+  }
+
+  SECTION("check if no spanning tree in worst case") {
+    Graph graph2{};
+
+    graph2.add_edge(a, a, {1});
+
+    auto vector = boruvka(graph2);
+
+    REQUIRE(vector.size() == 0);
+  }
+}
+
+TEST_CASE("Boruvka minimum spanning tree for undirected matrix graph",
+          "[boruvka][matrix_graph][undirected]") {
+  using Graph =
+      AdjacencyMatrixGraph<unsigned long, Directedness::UNDIRECTED, int>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d };
+
+  graph.add_edge(a, b, {2});
+  graph.add_edge(a, c, {1});
+  graph.add_edge(a, d, {4});
+  graph.add_edge(b, c, {3});
+  graph.add_edge(c, d, {9});
+
+  SECTION("find mimimum spanning tree") {
+    auto vector = boruvka(graph);
+
+    REQUIRE(vector.size() == 3);
+    REQUIRE(std::get<2>(vector[0]) == 1);
+    REQUIRE(std::get<2>(vector[1]) == 2);
+    REQUIRE(std::get<2>(vector[2]) == 4);
+  }
+}
+
+TEST_CASE("Boruvka minimum spanning forest for random graphs",
+          "[boruvka][list_graph]") {
+  std::mt19937 generator(31);
+  const unsigned long num_vertices = 3000;
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+  std::uniform_int_distribution<int> pick_weight(0, 20);
+
+  auto total_weight = [](const auto &edges) {
+    long total = 0;
+    for (auto &edge : edges) {
+      total += std::get<2>(edge);
+    }
+    return total;
+  };
+
+  SECTION("undirected graph with many equal weights") {
+    AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED, int> graph{};
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      graph.add_vertex(v);
+    }
+    for (size_t i = 0; i < 6000; ++i) {
+      graph.add_edge(pick(generator), pick(generator),
+                     {pick_weight(generator)});
+    }
+
+    auto expected = kruskal(graph);
+    auto actual = boruvka(
+        graph, [](const auto &edge) { return std::get<2>(edge); }, 4);
+
+    REQUIRE(actual.size() == expected.size());
+    REQUIRE(total_weight(actual) == total_weight(expected));
+  }
+
+  SECTION("directed graph") {
+    AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int> graph{};
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      graph.add_vertex(v);
+    }
+    for (size_t i = 0; i < 9000; ++i) {
+      graph.add_edge(pick(generator), pick(generator),
+                     {pick_weight(generator)});
+    }
+
+    auto expected = kruskal(graph);
+    auto actual = boruvka(
+        graph, [](const auto &edge) { return std::get<2>(edge); }, 4);
+
+    REQUIRE(actual.size() == expected.size());
+    REQUIRE(total_weight(actual) == total_weight(expected));
+  }
+}
+
+} // namespace boruvka_test
@@ -0,0 +1,176 @@
+/**
+ * @file This file is the test file of the vertex coloring algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp"
+#include "base.hpp"
+#include "catch.hpp"
+#include "coloring.hpp"
+#include "k_core.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace coloring_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+template <typename Id>
+bool is_proper(const CompressedSparseRow<Id> &symmetric,
+               const Coloring &coloring) {
+  if (coloring.color.size() != symmetric.num_vertices()) {
+    return false;
+  }
+  for (Id v = 0; v < symmetric.num_vertices(); ++v) {
+    if (coloring.color[v] >= coloring.num_colors) {
+      return false;
+    }
+    for (auto u : symmetric[v]) {
+      if (coloring.color[u] == coloring.color[v]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+TEST_CASE("Coloring for undirected list graph",
+          "[coloring][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  // A complete graph on 0..3 and a tree hanging from it
+  graph.add_edge(0, 1);
+  graph.add_edge(0, 2);
+  graph.add_edge(0, 3);
+  graph.add_edge(1, 2);
+  graph.add_edge(1, 3);
+  graph.add_edge(2, 3);
+  graph.add_edge(3, 4);
+  graph.add_edge(4, 5);
+  graph.add_edge(4, 6);
+  graph.add_edge(6, 7);
+  graph.add_vertex(8);
+  auto symmetric = make_symmetric_csr(graph);
+
+  SECTION("greedy orders use as many colors as the clique") {
+    auto largest_first = greedy_coloring(graph, ColoringOrder::LARGEST_FIRST);
+    auto smallest_last = greedy_coloring(graph, ColoringOrder::SMALLEST_LAST);
+
+    REQUIRE(is_proper(symmetric, largest_first));
+    REQUIRE(largest_first.num_colors == 4);
+    REQUIRE(is_proper(symmetric, smallest_last));
+    REQUIRE(smallest_last.num_colors == 4);
+  }
+
+  SECTION("parallel speculative coloring") {
+    auto coloring = parallel_coloring(graph, 2);
+
+    REQUIRE(is_proper(symmetric, coloring));
+    REQUIRE(coloring.num_colors >= 4);
+    REQUIRE(coloring.num_colors <= 5);
+  }
+}
+
+TEST_CASE("Coloring for directed matrix graph",
+          "[coloring][matrix_graph][directed]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  // An even cycle with a self loop and parallel edges
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 0);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 3);
+  graph.add_edge(3, 0);
+  graph.add_edge(3, 3);
+
+  SECTION("ignores directions, parallel edges and self loops") {
+    auto symmetric = make_symmetric_csr(graph);
+    auto coloring = greedy_coloring(graph);
+
+    REQUIRE(is_proper(symmetric, coloring));
+    REQUIRE(coloring.num_colors == 2);
+    REQUIRE(is_proper(symmetric, parallel_coloring(graph)));
+  }
+}
+
+TEST_CASE("Coloring for random graphs", "[coloring][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  const unsigned long num_vertices = 5000;
+  std::mt19937 generator(43);
+  std::uniform_real_distribution<double> uniform(0, 1);
+
+  // Skewed degrees, so that the orders matter
+  Graph graph{};
+  graph.add_vertex(num_vertices - 1);
+  for (size_t i = 0; i < 40000; ++i) {
+    auto u = static_cast<unsigned long>(num_vertices * uniform(generator) *
+                                        uniform(generator));
+    auto v = static_cast<unsigned long>(num_vertices * uniform(generator));
+    graph.add_edge(u, v);
+  }
+  auto symmetric = make_symmetric_csr(graph);
+  size_t max_degree = 0;
+  for (unsigned long v = 0; v < num_vertices; ++v) {
+    max_degree = std::max(max_degree, symmetric.degree(v));
+  }
+  auto core = core_numbers(symmetric);
+  size_t degeneracy = *std::max_element(core.begin(), core.end());
+
+  SECTION("smallest last uses at most one color more than the degeneracy") {
+    auto coloring = greedy_coloring(symmetric, ColoringOrder::SMALLEST_LAST);
+
+    REQUIRE(is_proper(symmetric, coloring));
+    REQUIRE(coloring.num_colors <= degeneracy + 1);
+  }
+
+  SECTION("largest first") {
+    auto coloring = greedy_coloring(symmetric, ColoringOrder::LARGEST_FIRST);
+
+    REQUIRE(is_proper(symmetric, coloring));
+    REQUIRE(coloring.num_colors <= max_degree + 1);
+  }
+
+  SECTION("parallel speculative coloring") {
+    for (size_t num_threads : {1, 2, 4}) {
+      auto coloring = parallel_coloring(symmetric, num_threads);
+
+      REQUIRE(is_proper(symmetric, coloring));
+      REQUIRE(coloring.num_colors <= max_degree + 1);
+    }
+  }
+}
+
+} // namespace coloring_test
@@ -0,0 +1,186 @@
+/**
+ * @file This file is the test file of the community detection algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "community.hpp"
+#include "exceptions.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <random>
+#include <vector>
+
+namespace community_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+auto unit = [](const auto &) { return 1; };
+
+TEST_CASE("Community detection for weighted undirected list graph",
+          "[community][list_graph][undirected]") {
+  using Graph =
+      AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED, int>;
+  Graph graph{};
+
+  // Two complete graphs on five vertices joined by a lighter edge
+  for (unsigned long first : {0ul, 5ul}) {
+    for (unsigned long u = first; u < first + 5; ++u) {
+      for (unsigned long v = u + 1; v < first + 5; ++v) {
+        graph.add_edge(u, v, {2});
+      }
+    }
+  }
+  graph.add_edge(4, 5, {1});
+
+  std::vector<unsigned long> expected{0, 0, 0, 0, 0, 1, 1, 1, 1, 1};
+  // Twice 20 / 41 - (41 / 82)^2
+  double expected_modularity = 2 * (20.0 / 41 - 0.25);
+
+  SECTION("computes the modularity of a partition") {
+    REQUIRE(modularity(graph, expected) == Approx(expected_modularity));
+    REQUIRE(modularity(graph, std::vector<unsigned long>(10, 3)) ==
+            Approx(0).margin(1e-12));
+    REQUIRE(modularity(graph, expected, unit) ==
+            Approx(2 * (10.0 / 21 - 0.25)));
+  }
+
+  SECTION("Louvain separates the complete graphs") {
+    auto communities = louvain(graph, unit, 2);
+
+    REQUIRE(communities.community == expected);
+    REQUIRE(communities.num_communities == 2);
+    REQUIRE(communities.modularity == Approx(2 * (10.0 / 21 - 0.25)));
+  }
+
+  SECTION("label propagation separates the complete graphs") {
+    auto communities = label_propagation(
+        graph, [](const auto &edge) { return std::get<2>(edge); }, 100, 2);
+
+    REQUIRE(communities.community == expected);
+    REQUIRE(communities.num_communities == 2);
+    REQUIRE(communities.modularity == Approx(expected_modularity));
+  }
+}
+
+TEST_CASE("Community detection for weighted directed matrix graph",
+          "[community][matrix_graph][directed]") {
+  using Graph =
+      AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED, double>;
+  Graph graph{};
+
+  graph.add_edge(0, 1, {10});
+  graph.add_edge(1, 2, {1});
+  graph.add_edge(2, 3, {10});
+  graph.add_edge(3, 0, {1});
+  graph.add_vertex(4);
+
+  SECTION("follows the heavy edges regardless of their direction") {
+    auto communities = louvain(graph);
+
+    REQUIRE(communities.community ==
+            std::vector<unsigned long>{0, 0, 1, 1, 2});
+    REQUIRE(communities.num_communities == 3);
+    REQUIRE(communities.modularity ==
+            Approx(modularity(graph, communities.community)));
+  }
+
+  SECTION("label propagation leaves isolated vertices alone") {
+    auto communities = label_propagation(graph);
+
+    REQUIRE(communities.community[4] == 2);
+    REQUIRE(communities.community[0] == communities.community[1]);
+  }
+
+  SECTION("rejects negative weights") {
+    graph.add_edge(4, 0, {-1});
+
+    REQUIRE_THROWS_AS(louvain(graph), exceptions::InvariantViolationException);
+    REQUIRE_THROWS_AS(label_propagation(graph),
+                      exceptions::InvariantViolationException);
+  }
+}
+
+TEST_CASE("Community detection for planted partitions",
+          "[community][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  const unsigned long num_groups = 8;
+  const unsigned long group_size = 60;
+  const unsigned long num_vertices = num_groups * group_size;
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+  std::uniform_int_distribution<unsigned long> member(0, group_size - 1);
+
+  Graph graph{};
+  graph.add_vertex(num_vertices - 1);
+  for (unsigned long group = 0; group < num_groups; ++group) {
+    for (size_t i = 0; i < 6 * group_size; ++i) {
+      auto u = group * group_size + member(generator);
+      auto v = group * group_size + member(generator);
+      if (u != v) {
+        graph.add_edge(u, v);
+      }
+    }
+  }
+  for (size_t i = 0; i < num_vertices / 2; ++i) {
+    auto u = pick(generator);
+    auto v = pick(generator);
+    if (u != v) {
+      graph.add_edge(u, v);
+    }
+  }
+
+  std::vector<unsigned long> planted(num_vertices);
+  for (unsigned long v = 0; v < num_vertices; ++v) {
+    planted[v] = v / group_size;
+  }
+  double planted_modularity = modularity(graph, planted, unit);
+
+  SECTION("Louvain finds at least as good a partition") {
+    auto communities = louvain(graph, unit, 4);
+
+    REQUIRE(communities.modularity == Approx(modularity(
+                                          graph, communities.community, unit)));
+    REQUIRE(communities.modularity >= planted_modularity - 1e-9);
+    REQUIRE(communities.num_communities == num_groups);
+  }
+
+  SECTION("label propagation finds a good partition") {
+    auto communities = label_propagation(graph, unit, 100, 4);
+
+    REQUIRE(communities.modularity == Approx(modularity(
+                                          graph, communities.community, unit)));
+    REQUIRE(communities.modularity > 0.5 * planted_modularity);
+  }
+}
+
+} // namespace community_test
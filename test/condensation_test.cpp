@@ -0,0 +1,154 @@
+/**
+ * @file This file is the test file of the graph condensation
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "condensation.hpp"
+#include "list_graph.hpp"
+#include "parallel_scc.hpp"
+#include "tarjan.hpp"
+
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace condensation_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+TEST_CASE("Condensation of directed list graph",
+          "[condensation][list_graph][directed]") {
+  using Graph =
+      AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d, e, f };
+
+  graph.add_edge(a, b, {4});
+  graph.add_edge(b, c, {1});
+  graph.add_edge(c, a, {2});
+  graph.add_edge(d, b, {7});
+  graph.add_edge(d, c, {3});
+  graph.add_edge(d, e, {5});
+  graph.add_edge(e, d, {6});
+  graph.add_edge(e, f, {8});
+  graph.add_edge(c, f, {9});
+
+  auto components = parallel_scc(graph);
+
+  SECTION("merges parallel edges between components") {
+    auto condensed = condensation(graph, components);
+
+    REQUIRE(condensed.graph.num_vertices() == 3);
+    REQUIRE(condensed.graph.offsets() == std::vector<size_t>{0, 1, 3, 3});
+    REQUIRE(condensed.graph.targets() == std::vector<unsigned long>{2, 0, 2});
+    REQUIRE(condensed.multiplicity == std::vector<size_t>{1, 2, 1});
+  }
+
+  SECTION("keeps the minimum weight of merged edges") {
+    auto condensed = weighted_condensation(graph, components.component,
+                                           components.sizes.size());
+
+    REQUIRE(condensed.graph.targets() == std::vector<unsigned long>{2, 0, 2});
+    REQUIRE(condensed.multiplicity == std::vector<size_t>{1, 2, 1});
+    REQUIRE(condensed.min_weight == std::vector<int>{9, 3, 8});
+  }
+
+  SECTION("accepts the components found by tarjan") {
+    auto scc_vector = tarjan(graph);
+    auto condensed = condensation(
+        graph, to_scc_components(scc_vector, graph.num_vertices()));
+
+    REQUIRE(condensed.graph.num_vertices() == scc_vector.size());
+    REQUIRE(condensed.graph.num_edges() == 3);
+    // tarjan finds components in reverse topological order
+    for (size_t c = 0; c < condensed.graph.num_vertices(); ++c) {
+      for (auto target : condensed.graph[c]) {
+        REQUIRE(target < c);
+      }
+    }
+  }
+}
+
+TEST_CASE("Condensation of random graphs",
+          "[condensation][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  std::mt19937 generator(29);
+
+  for (size_t round = 0; round < 5; ++round) {
+    Graph graph{};
+    const unsigned long num_vertices = 300;
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      graph.add_vertex(v);
+    }
+    std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+    for (size_t i = 0; i < 900; ++i) {
+      graph.add_edge(pick(generator), pick(generator));
+    }
+
+    auto components = parallel_scc(graph, 2);
+    auto condensed = condensation(graph, components);
+
+    std::set<std::pair<unsigned long, unsigned long>> expected;
+    size_t inter_component_edges = 0;
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      for (auto &&edge : graph[v]) {
+        auto source = components.component[graph.get_source(edge)];
+        auto target = components.component[graph.get_target(edge)];
+        if (source != target) {
+          expected.insert(std::make_pair(source, target));
+          ++inter_component_edges;
+        }
+      }
+    }
+
+    std::set<std::pair<unsigned long, unsigned long>> actual;
+    size_t merged_edges = 0;
+    for (unsigned long c = 0; c < condensed.graph.num_vertices(); ++c) {
+      auto targets = condensed.graph[c];
+      size_t first = condensed.graph.offsets()[c];
+      for (size_t i = 0; i < targets.size(); ++i) {
+        if (i > 0) {
+          REQUIRE(targets[i - 1] < targets[i]);
+        }
+        actual.insert(std::make_pair(c, targets[i]));
+        merged_edges += condensed.multiplicity[first + i];
+      }
+    }
+
+    REQUIRE(actual == expected);
+    REQUIRE(merged_edges == inter_component_edges);
+  }
+}
+
+} // namespace condensation_test
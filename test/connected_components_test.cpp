@@ -0,0 +1,141 @@
+/**
+ * @file This file is the test file of the parallel connected components algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "connected_components.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <random>
+#include <vector>
+
+namespace connected_components_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+TEST_CASE("Connected components for undirected list graph",
+          "[connected_components][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(4, 1);
+  graph.add_edge(1, 3);
+  graph.add_edge(2, 5);
+  graph.add_edge(6, 6);
+
+  SECTION("labels every vertex with the smallest vertex of its component") {
+    auto labels = connected_components(graph, 2);
+
+    REQUIRE(labels == std::vector<unsigned long>{0, 1, 2, 1, 1, 2, 6});
+  }
+}
+
+TEST_CASE("Connected components for directed matrix graph",
+          "[connected_components][matrix_graph][directed]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 1);
+  graph.add_edge(2, 1);
+  graph.add_edge(3, 4);
+
+  SECTION("finds weakly connected components") {
+    auto labels = connected_components(graph);
+
+    REQUIRE(labels == std::vector<unsigned long>{0, 0, 0, 3, 3});
+  }
+}
+
+TEST_CASE("Connected components for random graphs",
+          "[connected_components][list_graph]") {
+  std::mt19937 generator(35);
+  const unsigned long num_vertices = 3000;
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+
+  // Reference labels, propagating the minimum label until nothing changes
+  auto expected_labels = [&](const auto &graph) {
+    std::vector<unsigned long> labels(num_vertices);
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      labels[v] = v;
+    }
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (unsigned long v = 0; v < num_vertices; ++v) {
+        for (auto &edge : graph[v]) {
+          auto &source = labels[graph.get_source(edge)];
+          auto &target = labels[graph.get_target(edge)];
+          if (source != target) {
+            source = target = std::min(source, target);
+            changed = true;
+          }
+        }
+      }
+    }
+    return labels;
+  };
+
+  SECTION("directed graph with a giant component and small ones") {
+    AdjacencyListGraph<unsigned long, Directedness::DIRECTED> graph{};
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      graph.add_vertex(v);
+    }
+    for (size_t i = 0; i < 2500; ++i) {
+      auto u = pick(generator);
+      auto v = pick(generator);
+      if (!graph.has_edge(u, v)) {
+        graph.add_edge(u, v);
+      }
+    }
+
+    REQUIRE(connected_components(graph, 4) == expected_labels(graph));
+  }
+
+  SECTION("undirected graph") {
+    AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED> graph{};
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      graph.add_vertex(v);
+    }
+    for (size_t i = 0; i < 1400; ++i) {
+      auto u = pick(generator);
+      auto v = pick(generator);
+      if (!graph.has_edge(u, v)) {
+        graph.add_edge(u, v);
+      }
+    }
+
+    REQUIRE(connected_components(graph, 4) == expected_labels(graph));
+  }
+}
+
+} // namespace connected_components_test
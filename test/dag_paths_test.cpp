@@ -0,0 +1,168 @@
+/**
+ * @file This file is the test file of the shortest and longest paths algorithms for directed acyclic graphs
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "bellman_ford.hpp"
+#include "catch.hpp"
+#include "dag_paths.hpp"
+#include "exceptions.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace dag_paths_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+TEST_CASE("DAG paths for weighted directed list graph",
+          "[dag_paths][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int>;
+  Graph graph{};
+
+  graph.add_edge(0, 1, {5});
+  graph.add_edge(0, 2, {3});
+  graph.add_edge(1, 3, {6});
+  graph.add_edge(1, 2, {-2});
+  graph.add_edge(2, 3, {7});
+  graph.add_edge(4, 0, {1});
+
+  SECTION("shortest paths allow negative weights") {
+    auto tree = dag_shortest_paths(graph, 0);
+
+    REQUIRE(tree[0].distance == 0);
+    REQUIRE(tree[2].distance == 3);
+    REQUIRE(tree[2].parent == 0);
+    REQUIRE(tree[3].distance == 10);
+    REQUIRE(tree[3].parent == 2);
+    REQUIRE(tree[4].distance == std::numeric_limits<int>::max());
+    REQUIRE(tree[4].parent == INVALID_VERTEX<Graph>);
+  }
+
+  SECTION("longest paths follow the heaviest chains") {
+    auto tree = dag_longest_paths(graph, 0);
+
+    REQUIRE(tree[1].distance == 5);
+    REQUIRE(tree[3].distance == 11);
+    REQUIRE(tree[3].parent == 1);
+    REQUIRE(tree[2].distance == 3);
+    REQUIRE(tree[4].distance == std::numeric_limits<int>::lowest());
+  }
+
+  SECTION("throws on cycles") {
+    graph.add_edge(3, 4, {1});
+
+    REQUIRE_THROWS_AS(dag_shortest_paths(graph, 0),
+                      exceptions::InvariantViolationException);
+    REQUIRE_THROWS_AS(dag_longest_paths(graph, 0),
+                      exceptions::InvariantViolationException);
+  }
+}
+
+TEST_CASE("DAG paths for floating point weights",
+          "[dag_paths][list_graph][directed]") {
+  using Graph =
+      AdjacencyListGraph<unsigned long, Directedness::DIRECTED, double>;
+  Graph graph{};
+
+  graph.add_edge(0, 1, {-2.0});
+  graph.add_edge(1, 2, {1.0});
+
+  SECTION("shortest paths allow negative weights") {
+    auto tree = dag_shortest_paths(graph, 0);
+
+    REQUIRE(tree[1].distance == -2.0);
+    REQUIRE(tree[1].parent == 0);
+    REQUIRE(tree[2].distance == -1.0);
+    REQUIRE(tree[2].parent == 1);
+  }
+
+  SECTION("longest paths allow negative weights") {
+    auto tree = dag_longest_paths(graph, 0);
+
+    REQUIRE(tree[1].distance == -2.0);
+    REQUIRE(tree[2].distance == -1.0);
+    REQUIRE(tree[2].parent == 1);
+  }
+}
+
+TEST_CASE("DAG longest paths for unsigned weights",
+          "[dag_paths][matrix_graph][directed]") {
+  using Graph =
+      AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED, unsigned>;
+  Graph graph{};
+
+  graph.add_edge(1, 0, {0});
+  graph.add_edge(0, 2, {0});
+  graph.add_edge(1, 2, {4});
+
+  SECTION("reaches vertices at distance zero") {
+    auto tree = dag_longest_paths(graph, 1);
+
+    REQUIRE(tree[0].distance == 0);
+    REQUIRE(tree[0].parent == 1);
+    REQUIRE(tree[2].distance == 4);
+    REQUIRE(tree[2].parent == 1);
+  }
+}
+
+TEST_CASE("DAG shortest paths for random graphs",
+          "[dag_paths][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int>;
+  const unsigned long num_vertices = 300;
+  std::mt19937 generator(41);
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+  std::uniform_int_distribution<int> weights(-10, 20);
+
+  Graph graph{};
+  graph.add_vertex(num_vertices - 1);
+  for (size_t i = 0; i < 2000; ++i) {
+    auto u = pick(generator);
+    auto v = pick(generator);
+    if (u < v) {
+      graph.add_edge(u, v, {weights(generator)});
+    }
+  }
+
+  SECTION("agrees with Bellman-Ford") {
+    auto tree = dag_shortest_paths(graph, 0);
+    auto expected = bellman_ford(graph, 0);
+
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      REQUIRE(tree[v].distance == expected[v].distance);
+    }
+  }
+}
+
+} // namespace dag_paths_test
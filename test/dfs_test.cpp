@@ -355,4 +355,130 @@ TEST_CASE("DFS Tree correct visited order for undirected matrix graph",
     }
   }
 }
+
+TEST_CASE("DFS driven by a visitor", "[DFS][list_graph][visitor]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d, e };
+
+  graph.add_edge(a, b); // 0->1
+  graph.add_edge(a, c); // 0->2
+  graph.add_edge(a, d); // 0->3
+  graph.add_edge(b, c); // 1->2
+  graph.add_edge(d, e); // 3->4
+
+  /*
+    A--->B--->C
+    --------->
+    |
+    |
+    ---->D--->E
+  */
+
+  SECTION("stops as soon as the searched vertex is discovered") {
+    struct FindVisitor : DefaultVisitor {
+      std::vector<Graph::Vertex> discovered;
+
+      VisitorAction discover_vertex(Graph::Vertex vertex) {
+        discovered.push_back(vertex);
+        return vertex == c ? VisitorAction::STOP : VisitorAction::CONTINUE;
+      }
+    };
+
+    FindVisitor visitor{};
+    auto tree = dfs(graph, a, visitor);
+
+    REQUIRE(visitor.discovered == std::vector<Graph::Vertex>{a, b, c});
+    REQUIRE(tree[c].parent == b);
+    REQUIRE(tree[d].status == VertexStatus::READY);
+  }
+
+  SECTION("skipped vertices are not expanded") {
+    struct SkipVisitor : DefaultVisitor {
+      VisitorAction discover_vertex(Graph::Vertex vertex) {
+        return vertex == d ? VisitorAction::SKIP : VisitorAction::CONTINUE;
+      }
+    };
+
+    auto tree = dfs(graph, a, SkipVisitor{});
+
+    REQUIRE(tree[d].status == VertexStatus::PROCESSED);
+    REQUIRE(tree[d].discovery_time == tree[d].finishing_time - 1);
+    REQUIRE(tree[e].status == VertexStatus::READY);
+  }
+
+  SECTION("finish events follow the depth-first order") {
+    struct FinishVisitor : DefaultVisitor {
+      std::vector<Graph::Vertex> finished;
+
+      VisitorAction finish_vertex(Graph::Vertex vertex) {
+        finished.push_back(vertex);
+        return VisitorAction::CONTINUE;
+      }
+    };
+
+    FinishVisitor visitor{};
+    dfs(graph, a, visitor);
+
+    REQUIRE(visitor.finished == std::vector<Graph::Vertex>{c, b, e, d, a});
+  }
+}
+
+TEST_CASE("DFS forest visits every vertex", "[DFS][list_graph][forest]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d, e };
+
+  graph.add_edge(b, a); // 1->0
+  graph.add_edge(c, d); // 2->3
+  graph.add_edge(d, e); // 3->4
+
+  /*
+    A<---B    C--->D--->E
+  */
+
+  SECTION("check if every vertex is a root or has a parent") {
+    auto tree = dfs_forest(graph);
+
+    for (size_t vertex = 0; vertex < graph.num_vertices(); vertex++) {
+      REQUIRE(tree[vertex].status == VertexStatus::PROCESSED);
+    }
+
+    REQUIRE(tree[a].parent == INVALID_VERTEX<Graph>);
+    REQUIRE(tree[b].parent == INVALID_VERTEX<Graph>);
+    REQUIRE(tree[c].parent == INVALID_VERTEX<Graph>);
+    REQUIRE(tree[d].parent == c);
+    REQUIRE(tree[e].parent == d);
+  }
+
+  SECTION("check if timestamps continue across the trees") {
+    auto tree = dfs_forest(graph);
+
+    REQUIRE(tree[a].discovery_time == 1);
+    REQUIRE(tree[a].finishing_time == 2);
+    REQUIRE(tree[b].discovery_time == 3);
+    REQUIRE(tree[c].discovery_time == 5);
+    REQUIRE(tree[c].finishing_time == 10);
+  }
+}
+
+TEST_CASE("DFS on a very deep graph", "[DFS][list_graph][deep]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  constexpr size_t length = 500000;
+  for (size_t vertex = 0; vertex + 1 < length; vertex++) {
+    graph.add_edge(vertex, vertex + 1);
+  }
+
+  SECTION("check if the whole path is visited without overflowing the stack") {
+    auto tree = dfs(graph, 0);
+
+    REQUIRE(tree[length - 1].status == VertexStatus::PROCESSED);
+    REQUIRE(tree[length - 1].parent == length - 2);
+    REQUIRE(tree[0].finishing_time == 2 * length);
+  }
+}
 } // namespace dfs_test
\ No newline at end of file
@@ -0,0 +1,166 @@
+/**
+ * @file This file is the test file of the diameter and eccentricity algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp"
+#include "base.hpp"
+#include "catch.hpp"
+#include "diameter.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <algorithm>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace diameter_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+// Eccentricities by a breadth first search from every vertex
+template <typename Id>
+std::vector<size_t> naive_eccentricities(const CompressedSparseRow<Id> &csr) {
+  std::vector<size_t> result(csr.num_vertices(), 0);
+  for (Id source = 0; source < csr.num_vertices(); ++source) {
+    std::vector<size_t> distance(csr.num_vertices(), csr.num_vertices());
+    std::queue<Id> queue;
+    distance[source] = 0;
+    queue.push(source);
+    while (!queue.empty()) {
+      Id vertex = queue.front();
+      queue.pop();
+      result[source] = distance[vertex];
+      for (auto neighbour : csr[vertex]) {
+        if (distance[neighbour] == csr.num_vertices()) {
+          distance[neighbour] = distance[vertex] + 1;
+          queue.push(neighbour);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+TEST_CASE("Diameter and eccentricities for undirected list graph",
+          "[diameter][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  // A path 0..4 with a triangle on 2, and a separate edge
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 3);
+  graph.add_edge(3, 4);
+  graph.add_edge(2, 5);
+  graph.add_edge(5, 6);
+  graph.add_edge(6, 2);
+  graph.add_edge(7, 8);
+  graph.add_vertex(9);
+
+  std::vector<size_t> expected{4, 3, 2, 3, 4, 3, 3, 1, 1, 0};
+
+  SECTION("exact eccentricities") {
+    REQUIRE(eccentricities(graph) == expected);
+  }
+
+  SECTION("diameter is the largest eccentricity") {
+    REQUIRE(diameter(graph) == 4);
+  }
+
+  SECTION("bounds after a single sweep") {
+    auto bounds = eccentricity_bounds(graph, 1);
+
+    REQUIRE(bounds.num_sweeps == 1);
+    for (size_t v = 0; v < expected.size(); ++v) {
+      REQUIRE(bounds.lower[v] <= expected[v]);
+      REQUIRE(expected[v] <= bounds.upper[v]);
+    }
+  }
+}
+
+TEST_CASE("Diameter for directed matrix graph",
+          "[diameter][matrix_graph][directed]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  // A directed cycle of length 6 with a self loop
+  for (unsigned long v = 0; v < 6; ++v) {
+    graph.add_edge(v, (v + 1) % 6);
+  }
+  graph.add_edge(2, 2);
+
+  SECTION("ignores directions and self loops") {
+    REQUIRE(diameter(graph) == 3);
+    REQUIRE(eccentricities(graph) == std::vector<size_t>(6, 3));
+  }
+}
+
+TEST_CASE("Diameter and eccentricities for random graphs",
+          "[diameter][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  const unsigned long num_vertices = 2000;
+  std::mt19937 generator(44);
+  std::uniform_int_distribution<unsigned long> uniform(0, num_vertices - 1);
+
+  // A long path with random shortcuts, so that eccentricities vary
+  Graph graph{};
+  for (unsigned long v = 0; v + 1 < num_vertices; ++v) {
+    graph.add_edge(v, v + 1);
+  }
+  for (size_t i = 0; i < 60; ++i) {
+    graph.add_edge(uniform(generator), uniform(generator));
+  }
+  auto symmetric = make_symmetric_csr(graph);
+  auto expected = naive_eccentricities(symmetric);
+
+  SECTION("bounding agrees with a search from every vertex") {
+    auto bounds = eccentricity_bounds(symmetric);
+
+    REQUIRE(bounds.lower == expected);
+    REQUIRE(bounds.upper == expected);
+    REQUIRE(bounds.num_sweeps < num_vertices);
+    REQUIRE(diameter(symmetric) ==
+            *std::max_element(expected.begin(), expected.end()));
+  }
+
+  SECTION("bounds within a budget of sweeps") {
+    auto bounds = eccentricity_bounds(symmetric, 5);
+
+    REQUIRE(bounds.num_sweeps == 5);
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      REQUIRE(bounds.lower[v] <= expected[v]);
+      REQUIRE(expected[v] <= bounds.upper[v]);
+    }
+  }
+}
+
+} // namespace diameter_test
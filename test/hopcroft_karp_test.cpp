@@ -0,0 +1,162 @@
+/**
+ * @file This file is the test file of the Hopcroft-Karp algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "hopcroft_karp.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+#include "max_flow.hpp"
+
+#include <random>
+#include <vector>
+
+namespace hopcroft_karp_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+template <typename Graph>
+size_t matching_size(const Graph &graph, const std::vector<bool> &is_left,
+                     const std::vector<Vertex<Graph>> &mate) {
+  size_t size = 0;
+  for (Vertex<Graph> vertex = 0; vertex < mate.size(); ++vertex) {
+    if (mate[vertex] == INVALID_VERTEX<Graph>) {
+      continue;
+    }
+    REQUIRE(mate[mate[vertex]] == vertex);
+    REQUIRE(is_left[vertex] != is_left[mate[vertex]]);
+    if (is_left[vertex]) {
+      REQUIRE(graph.has_edge(vertex, mate[vertex]));
+      ++size;
+    }
+  }
+  return size;
+}
+
+TEST_CASE("Hopcroft-Karp maximum matching for directed list graph",
+          "[hopcroft_karp][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  // left vertices 0, 1, 2, 3 and right vertices 4, 5, 6, 7
+  graph.add_edge(0, 4);
+  graph.add_edge(0, 5);
+  graph.add_edge(1, 4);
+  graph.add_edge(2, 5);
+  graph.add_edge(2, 6);
+  graph.add_edge(3, 5);
+  graph.add_vertex(7);
+
+  auto is_left = [](unsigned long vertex) { return vertex < 4; };
+  std::vector<bool> sides{true, true, true, true, false, false, false, false};
+
+  SECTION("finds a maximum matching") {
+    auto mate = hopcroft_karp(graph, is_left, false);
+
+    REQUIRE(matching_size(graph, sides, mate) == 3);
+    REQUIRE(mate[6] == 2);
+    REQUIRE(mate[7] == INVALID_VERTEX<Graph>);
+  }
+
+  SECTION("improves the greedy matching") {
+    auto mate = hopcroft_karp(graph, sides, true, 2);
+
+    REQUIRE(matching_size(graph, sides, mate) == 3);
+  }
+}
+
+TEST_CASE("Hopcroft-Karp maximum matching for undirected matrix graph",
+          "[hopcroft_karp][matrix_graph][undirected]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  // a path alternating between the sides, with a perfect matching
+  for (unsigned long vertex = 0; vertex + 1 < 10; ++vertex) {
+    graph.add_edge(vertex, vertex + 1);
+  }
+  std::vector<bool> sides(10);
+  for (unsigned long vertex = 0; vertex < 10; ++vertex) {
+    sides[vertex] = vertex % 2 == 0;
+  }
+
+  auto mate = hopcroft_karp(graph, sides);
+
+  REQUIRE(matching_size(graph, sides, mate) == 5);
+}
+
+TEST_CASE("Hopcroft-Karp maximum matching for random bipartite graphs",
+          "[hopcroft_karp][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int>;
+  std::mt19937 generator(34);
+
+  for (size_t round = 0; round < 10; ++round) {
+    const unsigned long num_left = 150;
+    const unsigned long num_right = 120;
+    std::uniform_int_distribution<unsigned long> pick_left(0, num_left - 1);
+    std::uniform_int_distribution<unsigned long> pick_right(
+        num_left, num_left + num_right - 1);
+
+    // source and sink are the last two vertices, for the flow comparison
+    Graph graph{};
+    const unsigned long source = num_left + num_right;
+    const unsigned long sink = source + 1;
+    for (unsigned long vertex = 0; vertex <= sink; ++vertex) {
+      graph.add_vertex(vertex);
+    }
+    for (size_t i = 0; i < 300; ++i) {
+      unsigned long u = pick_left(generator);
+      unsigned long v = pick_right(generator);
+      if (!graph.has_edge(u, v)) {
+        graph.add_edge(u, v, {1});
+      }
+    }
+
+    std::vector<bool> sides(sink + 1, false);
+    for (unsigned long vertex = 0; vertex < num_left; ++vertex) {
+      sides[vertex] = true;
+    }
+
+    auto mate = hopcroft_karp(graph, sides, round % 2 == 0, 4);
+    auto size = matching_size(graph, sides, mate);
+
+    for (unsigned long vertex = 0; vertex < num_left; ++vertex) {
+      graph.add_edge(source, vertex, {1});
+    }
+    for (unsigned long vertex = num_left; vertex < source; ++vertex) {
+      graph.add_edge(vertex, sink, {1});
+    }
+
+    REQUIRE(static_cast<int>(size) == dinic(graph, source, sink));
+  }
+}
+
+} // namespace hopcroft_karp_test
@@ -0,0 +1,192 @@
+/**
+ * @file This file is the test file of the HyperANF algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "exceptions.hpp"
+#include "hyper_anf.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <cmath>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace hyper_anf_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+bool close(double value, double expected, double tolerance) {
+  return std::abs(value - expected) <= tolerance * expected;
+}
+
+TEST_CASE("HyperANF for directed list graph",
+          "[hyper_anf][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  // A path 0 -> 1 -> ... -> 9
+  for (unsigned long v = 0; v < 9; ++v) {
+    graph.add_edge(v, v + 1);
+  }
+
+  auto result = hyper_anf(graph, 10);
+
+  SECTION("one estimate per distance up to the diameter") {
+    REQUIRE(result.estimates.size() == 10);
+    for (size_t t = 0; t < result.estimates.size(); ++t) {
+      double expected = 0;
+      for (size_t v = 0; v < 10; ++v) {
+        expected += static_cast<double>(std::min(t, 9 - v) + 1);
+      }
+      REQUIRE(close(result.estimates[t], expected, 0.05));
+    }
+  }
+
+  SECTION("per-vertex reachable sets and distances") {
+    for (size_t v = 0; v < 10; ++v) {
+      double reachable = static_cast<double>(10 - v);
+      double sum_of_distances = reachable * (reachable - 1) / 2;
+      REQUIRE(close(result.reachable[v], reachable, 0.05));
+      REQUIRE(std::abs(result.sum_of_distances[v] - sum_of_distances) <=
+              0.05 * sum_of_distances + 0.5);
+    }
+  }
+
+  SECTION("effective diameter") {
+    double diameter = effective_diameter(result.estimates, 1);
+    REQUIRE(diameter > 8);
+    REQUIRE(diameter <= 9);
+  }
+}
+
+TEST_CASE("HyperANF for undirected matrix graph",
+          "[hyper_anf][matrix_graph][undirected]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  // Two disjoint triangles and an isolated vertex
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 0);
+  graph.add_edge(3, 4);
+  graph.add_edge(4, 5);
+  graph.add_edge(5, 3);
+  graph.add_vertex(6);
+
+  auto result = hyper_anf(graph, 8);
+
+  SECTION("balls stop at the components") {
+    REQUIRE(result.estimates.size() == 2);
+    REQUIRE(close(result.estimates[1], 19, 0.05));
+    for (size_t v = 0; v < 6; ++v) {
+      REQUIRE(close(result.reachable[v], 3, 0.05));
+    }
+    REQUIRE(close(result.reachable[6], 1, 0.05));
+    REQUIRE(result.sum_of_distances[6] == 0);
+  }
+
+  SECTION("rejects a number of registers out of range") {
+    REQUIRE_THROWS_AS(hyper_anf(graph, 3),
+                      exceptions::InvariantViolationException);
+    REQUIRE_THROWS_AS(hyper_anf(graph, 17),
+                      exceptions::InvariantViolationException);
+  }
+}
+
+TEST_CASE("HyperANF for random graphs", "[hyper_anf][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  const unsigned long num_vertices = 1000;
+  std::mt19937 generator(45);
+  std::uniform_int_distribution<unsigned long> uniform(0, num_vertices - 1);
+
+  Graph graph{};
+  graph.add_vertex(num_vertices - 1);
+  for (size_t i = 0; i < 2000; ++i) {
+    graph.add_edge(uniform(generator), uniform(generator));
+  }
+
+  // Exact neighbourhood function by a breadth first search from every vertex
+  std::vector<double> expected;
+  for (unsigned long source = 0; source < num_vertices; ++source) {
+    std::vector<size_t> distance(num_vertices, num_vertices);
+    std::queue<unsigned long> queue;
+    distance[source] = 0;
+    queue.push(source);
+    while (!queue.empty()) {
+      auto vertex = queue.front();
+      queue.pop();
+      if (expected.size() <= distance[vertex]) {
+        expected.resize(distance[vertex] + 1, 0);
+      }
+      expected[distance[vertex]] += 1;
+      for (auto &&edge : graph[vertex]) {
+        auto target = graph.get_target(edge);
+        if (distance[target] == num_vertices) {
+          distance[target] = distance[vertex] + 1;
+          queue.push(target);
+        }
+      }
+    }
+  }
+  for (size_t t = 1; t < expected.size(); ++t) {
+    expected[t] += expected[t - 1];
+  }
+
+  auto result = hyper_anf(graph, 10, std::numeric_limits<size_t>::max(), 7, 4);
+
+  SECTION("estimates are close to the exact neighbourhood function") {
+    for (size_t t = 0; t < expected.size(); ++t) {
+      double estimate = t < result.estimates.size() ? result.estimates[t]
+                                                    : result.estimates.back();
+      REQUIRE(close(estimate, expected[t], 0.1));
+    }
+  }
+
+  SECTION("results do not depend on the number of threads") {
+    auto serial =
+        hyper_anf(graph, 10, std::numeric_limits<size_t>::max(), 7, 1);
+
+    REQUIRE(serial.estimates == result.estimates);
+    REQUIRE(serial.reachable == result.reachable);
+  }
+
+  SECTION("a budget of iterations truncates the neighbourhood function") {
+    auto truncated = hyper_anf(graph, 10, 2, 7);
+
+    REQUIRE(truncated.estimates.size() == 3);
+    REQUIRE(truncated.estimates[2] == result.estimates[2]);
+  }
+}
+
+} // namespace hyper_anf_test
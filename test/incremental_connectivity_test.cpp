@@ -0,0 +1,145 @@
+/**
+ * @file This file is the test file of the incremental connectivity structure
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "connected_components.hpp"
+#include "incremental_connectivity.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <random>
+#include <vector>
+
+namespace incremental_connectivity_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+TEST_CASE("Incremental connectivity for undirected list graph",
+          "[incremental_connectivity][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 1);
+  graph.add_edge(2, 3);
+  graph.add_vertex(4);
+
+  IncrementalConnectivity connectivity(graph, 2);
+
+  SECTION("starts from the components of the graph") {
+    REQUIRE(connectivity.num_components() == 3);
+    REQUIRE(connectivity.connected(1, 0));
+    REQUIRE_FALSE(connectivity.connected(1, 2));
+    REQUIRE(connectivity.component(3) == 2);
+  }
+
+  SECTION("merges components when edges are added") {
+    connectivity.add_edge(3, 1);
+
+    REQUIRE(graph.has_edge(1, 3));
+    REQUIRE(connectivity.num_components() == 2);
+    REQUIRE(connectivity.connected(0, 2));
+    REQUIRE(connectivity.component(3) == 0);
+  }
+
+  SECTION("tracks the vertices added by new edges") {
+    REQUIRE_FALSE(connectivity.connected(4, 6));
+
+    connectivity.add_edge(6, 4);
+
+    REQUIRE(graph.num_vertices() == 7);
+    REQUIRE(connectivity.num_components() == 4);
+    REQUIRE(connectivity.connected(4, 6));
+    REQUIRE_FALSE(connectivity.connected(5, 6));
+  }
+
+  SECTION("adds batches of edges") {
+    connectivity.add_edges({{1, 2}, {4, 5}, {5, 4}}, 2);
+
+    REQUIRE(graph.num_edges() == 8);
+    REQUIRE(connectivity.num_components() == 2);
+    REQUIRE(connectivity.connected(0, 3));
+    REQUIRE(connectivity.component(5) == 4);
+  }
+}
+
+TEST_CASE("Incremental connectivity for directed weighted matrix graph",
+          "[incremental_connectivity][matrix_graph][directed]") {
+  using Graph =
+      AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED, int>;
+  Graph graph{};
+
+  graph.add_edge(1, 0, {3});
+
+  IncrementalConnectivity connectivity(graph);
+
+  SECTION("keeps weakly connected components and edge attributes") {
+    connectivity.add_edge(1, 2, {5});
+    connectivity.add_edges({{3, 2, 7}});
+
+    REQUIRE(std::get<0>(graph.get_attributes(3, 2)) == 7);
+    REQUIRE(connectivity.num_components() == 1);
+    REQUIRE(connectivity.connected(0, 3));
+  }
+}
+
+TEST_CASE("Incremental connectivity for random edge streams",
+          "[incremental_connectivity][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  const unsigned long num_vertices = 2000;
+  std::mt19937 generator(36);
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+
+  Graph graph{};
+  graph.add_vertex(num_vertices - 1);
+  IncrementalConnectivity connectivity(graph, 4);
+
+  SECTION("agrees with a full recomputation after every batch") {
+    for (size_t batch = 0; batch < 4; ++batch) {
+      std::vector<Graph::Edge> edges(300);
+      for (auto &edge : edges) {
+        edge = {pick(generator), pick(generator)};
+      }
+      connectivity.add_edges(edges, 4);
+
+      auto labels = connected_components(graph);
+      size_t num_components = 0;
+      for (unsigned long v = 0; v < num_vertices; ++v) {
+        REQUIRE(connectivity.component(v) == labels[v]);
+        num_components += labels[v] == v;
+      }
+      REQUIRE(connectivity.num_components() == num_components);
+    }
+  }
+}
+
+} // namespace incremental_connectivity_test
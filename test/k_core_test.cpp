@@ -0,0 +1,144 @@
+/**
+ * @file This file is the test file of the k-core decomposition algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp"
+#include "base.hpp"
+#include "catch.hpp"
+#include "k_core.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <random>
+#include <vector>
+
+namespace k_core_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+TEST_CASE("Core numbers for undirected list graph",
+          "[k_core][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  // A complete graph on 0..3, a triangle hanging from it and a path
+  graph.add_edge(0, 1);
+  graph.add_edge(0, 2);
+  graph.add_edge(0, 3);
+  graph.add_edge(1, 2);
+  graph.add_edge(1, 3);
+  graph.add_edge(2, 3);
+  graph.add_edge(3, 4);
+  graph.add_edge(3, 5);
+  graph.add_edge(4, 5);
+  graph.add_edge(5, 6);
+  graph.add_edge(6, 7);
+  graph.add_vertex(8);
+
+  std::vector<size_t> expected{3, 3, 3, 3, 2, 2, 1, 1, 0};
+
+  SECTION("serial bucket algorithm") {
+    REQUIRE(core_numbers(graph) == expected);
+  }
+
+  SECTION("parallel peeling") {
+    REQUIRE(parallel_core_numbers(graph, 2) == expected);
+  }
+}
+
+TEST_CASE("Core numbers for directed matrix graph",
+          "[k_core][matrix_graph][directed]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 0);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 0);
+  graph.add_edge(3, 3);
+  graph.add_edge(3, 2);
+
+  SECTION("ignores directions, parallel edges and self loops") {
+    std::vector<size_t> expected{2, 2, 2, 1};
+
+    REQUIRE(core_numbers(graph) == expected);
+    REQUIRE(parallel_core_numbers(graph) == expected);
+  }
+}
+
+TEST_CASE("Core numbers for random graphs", "[k_core][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  const unsigned long num_vertices = 5000;
+  std::mt19937 generator(39);
+  std::uniform_real_distribution<double> uniform(0, 1);
+
+  // Skewed degrees, so that many levels are peeled
+  Graph graph{};
+  graph.add_vertex(num_vertices - 1);
+  for (size_t i = 0; i < 40000; ++i) {
+    auto u = static_cast<unsigned long>(num_vertices * uniform(generator) *
+                                        uniform(generator));
+    auto v = static_cast<unsigned long>(num_vertices * uniform(generator));
+    graph.add_edge(u, v);
+  }
+  auto symmetric = make_symmetric_csr(graph);
+
+  SECTION("serial and parallel algorithms agree with a naive peeling") {
+    std::vector<size_t> expected(num_vertices, 0);
+    std::vector<size_t> degree(num_vertices);
+    std::vector<bool> removed(num_vertices, false);
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      degree[v] = symmetric.degree(v);
+    }
+    for (size_t k = 0, left = num_vertices; left > 0; ++k) {
+      bool changed = true;
+      while (changed) {
+        changed = false;
+        for (unsigned long v = 0; v < num_vertices; ++v) {
+          if (!removed[v] && degree[v] <= k) {
+            removed[v] = true;
+            expected[v] = k;
+            changed = true;
+            --left;
+            for (auto u : symmetric[v]) {
+              --degree[u];
+            }
+          }
+        }
+      }
+    }
+
+    REQUIRE(core_numbers(symmetric) == expected);
+    REQUIRE(parallel_core_numbers(symmetric, 4) == expected);
+  }
+}
+
+} // namespace k_core_test
@@ -0,0 +1,234 @@
+/**
+ * @file This file is the test file of Yen's K shortest paths algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "exceptions.hpp"
+#include "k_shortest_paths.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace k_shortest_paths_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+// Distances of all the loopless paths from vertex to target, by depth first
+// enumeration
+template <typename G>
+void all_distances(const G &graph, unsigned long vertex, unsigned long target,
+                   int distance, std::vector<bool> &on_path,
+                   std::vector<int> &distances) {
+  if (vertex == target) {
+    distances.push_back(distance);
+    return;
+  }
+  on_path[vertex] = true;
+  for (auto &&edge : graph[vertex]) {
+    auto next = graph.get_target(edge);
+    if (!on_path[next]) {
+      all_distances(graph, next, target, distance + std::get<2>(edge),
+                    on_path, distances);
+    }
+  }
+  on_path[vertex] = false;
+}
+
+// Checks that the paths are distinct, loopless and made of edges of the graph
+// with the given distances
+template <typename G>
+void require_paths(
+    const G &graph, unsigned long source, unsigned long target,
+    const std::vector<WeightedPath<unsigned long, int>> &paths) {
+  std::set<std::vector<unsigned long>> distinct;
+  for (const auto &path : paths) {
+    REQUIRE(path.vertices.front() == source);
+    REQUIRE(path.vertices.back() == target);
+    REQUIRE(std::set<unsigned long>(path.vertices.begin(),
+                                    path.vertices.end())
+                .size() == path.vertices.size());
+    int distance = 0;
+    for (size_t i = 0; i + 1 < path.vertices.size(); ++i) {
+      REQUIRE(graph.has_edge(path.vertices[i], path.vertices[i + 1]));
+      distance += std::get<0>(
+          graph.get_attributes(path.vertices[i], path.vertices[i + 1]));
+    }
+    REQUIRE(distance == path.distance);
+    distinct.insert(path.vertices);
+  }
+  REQUIRE(distinct.size() == paths.size());
+}
+
+TEST_CASE("K shortest paths for weighted directed list graph",
+          "[k_shortest_paths][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int>;
+  Graph graph{};
+
+  // The example of Yen's paper, from C (0) to H (5)
+  graph.add_edge(0, 1, {3});
+  graph.add_edge(0, 2, {2});
+  graph.add_edge(1, 3, {4});
+  graph.add_edge(2, 1, {1});
+  graph.add_edge(2, 3, {2});
+  graph.add_edge(2, 4, {3});
+  graph.add_edge(3, 4, {2});
+  graph.add_edge(3, 5, {1});
+  graph.add_edge(4, 5, {2});
+
+  SECTION("paths by distance") {
+    auto paths = k_shortest_paths(graph, 0, 5, 4);
+
+    REQUIRE(paths.size() == 4);
+    REQUIRE(paths[0].vertices == std::vector<unsigned long>{0, 2, 3, 5});
+    REQUIRE(paths[0].distance == 5);
+    REQUIRE(paths[1].vertices == std::vector<unsigned long>{0, 2, 4, 5});
+    REQUIRE(paths[1].distance == 7);
+    // Two paths of distance 8, in any order
+    REQUIRE(paths[2].distance == 8);
+    REQUIRE(paths[3].distance == 8);
+    REQUIRE(std::set{paths[2].vertices, paths[3].vertices} ==
+            std::set<std::vector<unsigned long>>{{0, 1, 3, 5},
+                                                 {0, 2, 1, 3, 5}});
+    require_paths(graph, 0, 5, paths);
+  }
+
+  SECTION("fewer paths than requested") {
+    auto paths = k_shortest_paths(graph, 0, 5, 100);
+
+    REQUIRE(paths.size() == 7);
+    require_paths(graph, 0, 5, paths);
+    REQUIRE(k_shortest_paths(graph, 0, 5, 0).empty());
+  }
+
+  SECTION("unreachable target and single vertex path") {
+    REQUIRE(k_shortest_paths(graph, 5, 0, 3).empty());
+
+    auto paths = k_shortest_paths(graph, 2, 2, 3);
+    REQUIRE(paths.size() == 1);
+    REQUIRE(paths[0].vertices == std::vector<unsigned long>{2});
+    REQUIRE(paths[0].distance == 0);
+  }
+
+  SECTION("negative weights") {
+    graph.add_edge(4, 0, {-1});
+    REQUIRE_THROWS_AS(k_shortest_paths(graph, 0, 5, 2),
+                      exceptions::InvariantViolationException);
+  }
+}
+
+TEST_CASE("K shortest paths for weighted undirected matrix graph",
+          "[k_shortest_paths][matrix_graph][undirected]") {
+  using Graph =
+      AdjacencyMatrixGraph<unsigned long, Directedness::UNDIRECTED, int>;
+  Graph graph{};
+
+  // A square with a diagonal
+  graph.add_edge(0, 1, {1});
+  graph.add_edge(1, 2, {1});
+  graph.add_edge(2, 3, {1});
+  graph.add_edge(3, 0, {1});
+  graph.add_edge(0, 2, {3});
+
+  SECTION("edges are used in both directions") {
+    auto paths = k_shortest_paths(graph, 0, 2, 5);
+
+    REQUIRE(paths.size() == 3);
+    REQUIRE(std::set{paths[0].vertices, paths[1].vertices} ==
+            std::set<std::vector<unsigned long>>{{0, 1, 2}, {0, 3, 2}});
+    REQUIRE(paths[2].vertices == std::vector<unsigned long>{0, 2});
+    require_paths(graph, 0, 2, paths);
+  }
+}
+
+TEST_CASE("K shortest paths for floating point weights",
+          "[k_shortest_paths][list_graph][directed]") {
+  using Graph =
+      AdjacencyListGraph<unsigned long, Directedness::DIRECTED, double>;
+  Graph graph{};
+
+  graph.add_edge(0, 1, {0.0});
+  graph.add_edge(1, 2, {1.0});
+  graph.add_edge(0, 2, {5.0});
+
+  SECTION("zero weight edges are taken") {
+    auto paths = k_shortest_paths(graph, 0, 2, 3);
+
+    REQUIRE(paths.size() == 2);
+    REQUIRE(paths[0].vertices == std::vector<unsigned long>{0, 1, 2});
+    REQUIRE(paths[0].distance == 1.0);
+    REQUIRE(paths[1].vertices == std::vector<unsigned long>{0, 2});
+    REQUIRE(paths[1].distance == 5.0);
+  }
+}
+
+TEST_CASE("K shortest paths for random graphs",
+          "[k_shortest_paths][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int>;
+  const unsigned long num_vertices = 12;
+  std::mt19937 generator(47);
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+  std::uniform_int_distribution<int> weight(0, 9);
+
+  SECTION("distances agree with the enumeration of all the paths") {
+    for (int round = 0; round < 20; ++round) {
+      Graph graph{};
+      graph.add_vertex(num_vertices - 1);
+      for (size_t i = 0; i < 30; ++i) {
+        auto u = pick(generator);
+        auto v = pick(generator);
+        if (u != v) {
+          graph.add_edge(u, v, {weight(generator)});
+        }
+      }
+
+      std::vector<int> expected;
+      std::vector<bool> on_path(num_vertices, false);
+      all_distances(graph, 0, num_vertices - 1, 0, on_path, expected);
+      std::sort(expected.begin(), expected.end());
+      expected.resize(std::min<size_t>(expected.size(), 10));
+
+      auto paths = k_shortest_paths(graph, 0, num_vertices - 1, 10);
+      require_paths(graph, 0, num_vertices - 1, paths);
+      std::vector<int> distances;
+      for (const auto &path : paths) {
+        distances.push_back(path.distance);
+      }
+      REQUIRE(distances == expected);
+    }
+  }
+}
+
+} // namespace k_shortest_paths_test
@@ -36,6 +36,8 @@
 #include "list_graph.hpp"
 #include "matrix_graph.hpp"
 
+#include <random>
+
 namespace kruskal_test {
 using namespace graphxx;
 using namespace graphxx::algorithms;
@@ -328,4 +330,97 @@ TEST_CASE("Kruskal minimum spanning tree for undirected matrix graph",
     REQUIRE(vector.size() == 0);
   }
 }
+
+TEST_CASE("Filter-Kruskal minimum spanning tree for undirected list graph",
+          "[kruskal][filter_kruskal][list_graph][undirected]") {
+  using Graph =
+      AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED, int>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d };
+
+  graph.add_edge(a, b, {2});
+  graph.add_edge(a, c, {1});
+  graph.add_edge(a, d, {4});
+  graph.add_edge(b, c, {3});
+  graph.add_edge(c, d, {9});
+  graph.add_edge(d, d, {0});
+
+  SECTION("check if edges founded are correct") {
+    auto vector = filter_kruskal(graph);
+
+    REQUIRE(vector.size() == 3);
+    REQUIRE(graph.get_source(vector[0]) == a);
+    REQUIRE(graph.get_target(vector[0]) == c);
+    REQUIRE(graph.get_source(vector[1]) == a);
+    REQUIRE(graph.get_target(vector[1]) == b);
+    REQUIRE(graph.get_source(vector[2]) == a);
+    REQUIRE(graph.get_target(vector[2]) == d);
+  }
+
+  SECTION("check if no spanning tree in worst case") {
+    Graph graph2{};
+
+    graph2.add_edge(a, a, {1});
+
+    auto vector = filter_kruskal(graph2);
+
+    REQUIRE(vector.size() == 0);
+  }
+}
+
+TEST_CASE("Filter-Kruskal minimum spanning forest for random graphs",
+          "[kruskal][filter_kruskal][list_graph]") {
+  std::mt19937 generator(30);
+  const unsigned long num_vertices = 2000;
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+  std::uniform_int_distribution<int> pick_weight(0, 50);
+
+  auto total_weight = [](const auto &edges) {
+    long total = 0;
+    for (auto &edge : edges) {
+      total += std::get<2>(edge);
+    }
+    return total;
+  };
+
+  SECTION("undirected graph") {
+    AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED, int> graph{};
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      graph.add_vertex(v);
+    }
+    for (size_t i = 0; i < 12000; ++i) {
+      graph.add_edge(pick(generator), pick(generator),
+                     {pick_weight(generator)});
+    }
+
+    auto expected = kruskal(graph);
+    auto actual = filter_kruskal(
+        graph, [](const auto &edge) { return std::get<2>(edge); }, 4);
+
+    REQUIRE(actual.size() == expected.size());
+    REQUIRE(total_weight(actual) == total_weight(expected));
+    for (size_t i = 1; i < actual.size(); ++i) {
+      REQUIRE(std::get<2>(actual[i - 1]) <= std::get<2>(actual[i]));
+    }
+  }
+
+  SECTION("directed graph") {
+    AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int> graph{};
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      graph.add_vertex(v);
+    }
+    for (size_t i = 0; i < 20000; ++i) {
+      graph.add_edge(pick(generator), pick(generator),
+                     {pick_weight(generator)});
+    }
+
+    auto expected = kruskal(graph);
+    auto actual = filter_kruskal(
+        graph, [](const auto &edge) { return std::get<2>(edge); }, 4);
+
+    REQUIRE(actual.size() == expected.size());
+    REQUIRE(total_weight(actual) == total_weight(expected));
+  }
+}
 } // namespace kruskal_test
\ No newline at end of file
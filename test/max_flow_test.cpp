@@ -0,0 +1,228 @@
+/**
+ * @file This file is the test file of the maximum flow algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/residual_graph.hpp"
+#include "base.hpp"
+#include "catch.hpp"
+#include "ford_fulkerson.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+#include "max_flow.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace max_flow_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+TEST_CASE("Residual graph of directed list graph",
+          "[residual_graph][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int>;
+  Graph graph{};
+
+  graph.add_edge(0, 1, {5});
+  graph.add_edge(0, 2, {3});
+  graph.add_edge(2, 2, {1});
+  graph.add_edge(2, 1, {4});
+
+  auto network = make_residual_graph(graph);
+
+  SECTION("pairs every edge with a reverse arc") {
+    REQUIRE(network.num_vertices() == 3);
+    REQUIRE(network.num_arcs() == 6);
+
+    for (size_t arc = 0; arc < network.num_arcs(); ++arc) {
+      REQUIRE(network.reverse(network.reverse(arc)) == arc);
+    }
+
+    size_t arc = network.first_arc(0);
+    REQUIRE(network.head(arc) == 1);
+    REQUIRE(network.capacity(arc) == 5);
+    REQUIRE(network.edge_id(arc) == 0);
+    REQUIRE(network.capacity(network.reverse(arc)) == 0);
+    REQUIRE(network.edge_id(network.reverse(arc)) ==
+            decltype(network)::NO_EDGE);
+    REQUIRE(network.last_arc(2) - network.first_arc(2) == 2);
+  }
+
+  SECTION("pushes flow along paired arcs") {
+    size_t arc = network.first_arc(0);
+    network.push(arc, 2);
+
+    REQUIRE(network.residual(arc) == 3);
+    REQUIRE(network.flow(arc) == 2);
+    REQUIRE(network.residual(network.reverse(arc)) == 2);
+
+    network.reset();
+    REQUIRE(network.flow(arc) == 0);
+  }
+
+  SECTION("rejects negative capacities") {
+    REQUIRE_THROWS_AS(
+        make_residual_graph(graph, [](const auto &) { return -1; }),
+        exceptions::InvariantViolationException);
+  }
+}
+
+TEST_CASE("Maximum flow for directed list graph",
+          "[max_flow][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int>;
+  Graph graph{};
+
+  enum vertices { s, a, b, c, d, t };
+
+  graph.add_edge(s, a, {7});
+  graph.add_edge(s, d, {4});
+  graph.add_edge(a, b, {5});
+  graph.add_edge(a, c, {3});
+  graph.add_edge(b, t, {8});
+  graph.add_edge(c, b, {3});
+  graph.add_edge(c, t, {5});
+  graph.add_edge(d, a, {3});
+  graph.add_edge(d, c, {2});
+
+  /*
+    S----->A----->B-----v
+     ----->D------^     T
+            ------>C----^
+  */
+
+  SECTION("Dinic finds the maximum possible flow") {
+    REQUIRE(dinic(graph, s, t) == 10);
+    REQUIRE(dinic(graph, s, t, [](const auto &) { return 1; }) == 2);
+  }
+
+  SECTION("push-relabel finds the maximum possible flow") {
+    REQUIRE(push_relabel(graph, s, t) == 10);
+    REQUIRE(push_relabel(graph, s, t, [](const auto &) { return 1; }) == 2);
+  }
+
+  SECTION("leaves a flow whose minimum cut has the same capacity") {
+    auto network = make_residual_graph(graph);
+    auto flow = push_relabel(network, s, t);
+    auto source_side = min_cut(network, s);
+
+    REQUIRE(source_side[s]);
+    REQUIRE_FALSE(source_side[t]);
+
+    int cut = 0;
+    for (unsigned long vertex = 0; vertex < network.num_vertices(); ++vertex) {
+      for (size_t arc = network.first_arc(vertex);
+           arc < network.last_arc(vertex); ++arc) {
+        if (source_side[vertex] && !source_side[network.head(arc)]) {
+          cut += network.capacity(arc);
+        }
+      }
+    }
+    REQUIRE(cut == flow);
+  }
+
+  SECTION("no flow from a vertex to itself") {
+    REQUIRE(dinic(graph, s, s) == 0);
+    REQUIRE(push_relabel(graph, s, s) == 0);
+  }
+}
+
+TEST_CASE("Maximum flow for undirected matrix graph",
+          "[max_flow][matrix_graph][undirected]") {
+  using Graph =
+      AdjacencyMatrixGraph<unsigned long, Directedness::UNDIRECTED, int>;
+  Graph graph{};
+
+  enum vertices { s, a, b, t };
+
+  graph.add_edge(s, a, {3});
+  graph.add_edge(s, b, {2});
+  graph.add_edge(a, b, {4});
+  graph.add_edge(b, t, {3});
+  graph.add_edge(a, t, {1});
+
+  SECTION("edges carry flow in both directions") {
+    REQUIRE(dinic(graph, s, t) == 4);
+    REQUIRE(push_relabel(graph, s, t) == 4);
+    REQUIRE(dinic(graph, t, s) == 4);
+    REQUIRE(push_relabel(graph, t, s) == 4);
+  }
+}
+
+TEST_CASE("Maximum flow for random graphs", "[max_flow][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int>;
+  std::mt19937 generator(32);
+
+  for (size_t round = 0; round < 20; ++round) {
+    const unsigned long num_vertices = 40;
+    std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+    std::uniform_int_distribution<int> pick_capacity(1, 30);
+
+    Graph graph{};
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      graph.add_vertex(v);
+    }
+    std::vector<std::vector<int32_t>> capacities(
+        num_vertices, std::vector<int32_t>(num_vertices, 0));
+    for (size_t i = 0; i < 200; ++i) {
+      unsigned long u = pick(generator);
+      unsigned long v = pick(generator);
+      if (u != v && !graph.has_edge(u, v)) {
+        int capacity = pick_capacity(generator);
+        graph.add_edge(u, v, {capacity});
+        capacities[u][v] = capacity;
+      }
+    }
+
+    auto expected = ford_fulkerson(graph, 0ul, num_vertices - 1, capacities);
+
+    auto network = make_residual_graph(graph);
+    REQUIRE(dinic(network, 0, num_vertices - 1) == expected);
+
+    network.reset();
+    REQUIRE(push_relabel(network, 0, num_vertices - 1) == expected);
+
+    // the flow left by push-relabel is conserved at every inner vertex
+    for (unsigned long vertex = 1; vertex + 1 < num_vertices; ++vertex) {
+      int balance = 0;
+      for (size_t arc = network.first_arc(vertex);
+           arc < network.last_arc(vertex); ++arc) {
+        if (network.edge_id(arc) != decltype(network)::NO_EDGE) {
+          balance += network.flow(arc);
+        } else {
+          balance -= network.flow(network.reverse(arc));
+        }
+      }
+      REQUIRE(balance == 0);
+    }
+  }
+}
+
+} // namespace max_flow_test
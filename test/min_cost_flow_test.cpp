@@ -0,0 +1,205 @@
+/**
+ * @file This file is the test file of the minimum cost flow algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/residual_graph.hpp"
+#include "base.hpp"
+#include "catch.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+#include "max_flow.hpp"
+#include "min_cost_flow.hpp"
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace min_cost_flow_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+// Edges carry capacity and cost
+using Graph =
+    AdjacencyListGraph<unsigned long, Directedness::DIRECTED, int, int>;
+
+auto capacity = [](const Edge<Graph> &edge) { return std::get<2>(edge); };
+auto cost = [](const Edge<Graph> &edge) { return std::get<3>(edge); };
+
+TEST_CASE("Minimum cost flow for directed list graph",
+          "[min_cost_flow][list_graph][directed]") {
+  Graph graph{};
+
+  enum vertices { s, a, b, t };
+
+  graph.add_edge(s, a, {4, 2});
+  graph.add_edge(s, b, {2, 2});
+  graph.add_edge(a, b, {2, 1});
+  graph.add_edge(a, t, {3, 3});
+  graph.add_edge(b, t, {5, 1});
+
+  /*
+    S-----> A -----> T
+    |       |        ^
+    |-----> B -------|
+  */
+
+  SECTION("sends the maximum flow with the minimum cost") {
+    auto result = min_cost_flow(graph, s, t, capacity, cost);
+
+    REQUIRE(result.flow == 6);
+    REQUIRE(result.cost == 24);
+    REQUIRE(result.edge_flow == std::vector<int>{4, 2, 2, 2, 4});
+  }
+
+  SECTION("stops at the flow limit using the cheapest paths") {
+    auto result = min_cost_flow(graph, s, t, capacity, cost, 3);
+
+    REQUIRE(result.flow == 3);
+    REQUIRE(result.cost == 10);
+  }
+
+  SECTION("handles negative costs") {
+    auto result = min_cost_flow(
+        graph, s, t, capacity,
+        [](const Edge<Graph> &edge) { return std::get<3>(edge) - 3; });
+
+    REQUIRE(result.flow == 6);
+    REQUIRE(result.cost == -18);
+  }
+
+  SECTION("detects negative cycles") {
+    graph.add_edge(t, s, {1, -20});
+
+    REQUIRE_THROWS_AS(min_cost_flow(graph, s, t, capacity, cost),
+                      exceptions::InvariantViolationException);
+  }
+}
+
+TEST_CASE("Minimum cost assignment", "[min_cost_flow][list_graph][directed]") {
+  Graph graph{};
+
+  // workers 1, 2, 3 and jobs 4, 5, 6 between source 0 and sink 7
+  const std::vector<std::vector<int>> costs{{9, 2, 7}, {6, 4, 3}, {5, 8, 1}};
+  for (unsigned long worker = 0; worker < 3; ++worker) {
+    graph.add_edge(0, worker + 1, {1, 0});
+    for (unsigned long job = 0; job < 3; ++job) {
+      graph.add_edge(worker + 1, job + 4, {1, costs[worker][job]});
+    }
+  }
+  for (unsigned long job = 0; job < 3; ++job) {
+    graph.add_edge(job + 4, 7, {1, 0});
+  }
+
+  auto result = min_cost_flow(graph, 0, 7, capacity, cost);
+
+  REQUIRE(result.flow == 3);
+  REQUIRE(result.cost == 9);
+}
+
+TEST_CASE("Minimum cost flow for undirected matrix graph",
+          "[min_cost_flow][matrix_graph][undirected]") {
+  using UndirectedGraph =
+      AdjacencyMatrixGraph<unsigned long, Directedness::UNDIRECTED, int, int>;
+  UndirectedGraph graph{};
+
+  graph.add_edge(0, 1, {2, 1});
+  graph.add_edge(1, 2, {2, 1});
+  graph.add_edge(0, 2, {1, 5});
+
+  auto result = min_cost_flow(
+      graph, 2, 0, [](const auto &edge) { return std::get<2>(edge); },
+      [](const auto &edge) { return std::get<3>(edge); });
+
+  REQUIRE(result.flow == 3);
+  REQUIRE(result.cost == 9);
+}
+
+TEST_CASE("Minimum cost flow for random graphs",
+          "[min_cost_flow][list_graph][directed]") {
+  std::mt19937 generator(33);
+  const unsigned long num_vertices = 30;
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+  std::uniform_int_distribution<int> pick_capacity(1, 10);
+  std::uniform_int_distribution<int> pick_cost(0, 20);
+
+  for (size_t round = 0; round < 10; ++round) {
+    Graph graph{};
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      graph.add_vertex(v);
+    }
+    for (size_t i = 0; i < 150; ++i) {
+      unsigned long u = pick(generator);
+      unsigned long v = pick(generator);
+      if (u != v && !graph.has_edge(u, v)) {
+        graph.add_edge(u, v, {pick_capacity(generator), pick_cost(generator)});
+      }
+    }
+
+    auto network = make_directed_residual_graph(graph, capacity);
+    std::vector<int> arc_cost(network.num_arcs());
+    std::vector<int> edge_cost;
+    for (unsigned long vertex = 0; vertex < num_vertices; ++vertex) {
+      for (auto &edge : graph[vertex]) {
+        edge_cost.push_back(cost(edge));
+      }
+    }
+    for (size_t arc = 0; arc < network.num_arcs(); ++arc) {
+      if (network.edge_id(arc) != network.NO_EDGE) {
+        arc_cost[arc] = edge_cost[network.edge_id(arc)];
+        arc_cost[network.reverse(arc)] = -arc_cost[arc];
+      }
+    }
+
+    auto result = min_cost_flow(network, arc_cost, 0, num_vertices - 1);
+    REQUIRE(result.flow == dinic(graph, 0, num_vertices - 1, capacity));
+
+    // optimal iff the residual network has no negative cycle
+    std::vector<int> distance(num_vertices, 0);
+    bool changed = true;
+    for (size_t i = 0; i <= num_vertices && changed; ++i) {
+      changed = false;
+      for (unsigned long vertex = 0; vertex < num_vertices; ++vertex) {
+        for (size_t arc = network.first_arc(vertex);
+             arc < network.last_arc(vertex); ++arc) {
+          auto head = network.head(arc);
+          if (network.residual(arc) > 0 &&
+              distance[vertex] + arc_cost[arc] < distance[head]) {
+            distance[head] = distance[vertex] + arc_cost[arc];
+            changed = true;
+          }
+        }
+      }
+    }
+    REQUIRE_FALSE(changed);
+  }
+}
+
+} // namespace min_cost_flow_test
@@ -0,0 +1,173 @@
+/**
+ * @file This file is the test file of the PageRank algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp"
+#include "base.hpp"
+#include "catch.hpp"
+#include "exceptions.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+#include "pagerank.hpp"
+
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace pagerank_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+// Serial power iteration on the out edges, for reference
+template <typename G>
+std::vector<double> expected_ranks(const G &graph,
+                                   std::vector<double> teleport = {}) {
+  size_t size = graph.num_vertices();
+  if (teleport.empty()) {
+    teleport.assign(size, 1.0 / size);
+  }
+  std::vector<double> rank = teleport;
+  for (size_t iteration = 0; iteration < 200; ++iteration) {
+    std::vector<double> next(size, 0);
+    double dangling = 0;
+    for (unsigned long v = 0; v < size; ++v) {
+      auto degree = std::ranges::distance(graph[v]);
+      if (degree == 0) {
+        dangling += rank[v];
+      }
+      for (auto &edge : graph[v]) {
+        next[graph.get_target(edge)] += 0.85 * rank[v] / degree;
+      }
+    }
+    for (unsigned long v = 0; v < size; ++v) {
+      next[v] += (0.15 + 0.85 * dangling) * teleport[v];
+    }
+    rank = next;
+  }
+  return rank;
+}
+
+TEST_CASE("PageRank for directed list graph",
+          "[pagerank][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 0);
+
+  SECTION("gives the same rank to the vertices of a cycle") {
+    auto ranks = pagerank(graph);
+
+    for (auto rank : ranks) {
+      REQUIRE(rank == Approx(1.0 / 3));
+    }
+  }
+
+  SECTION("spreads the rank of dangling vertices") {
+    graph.add_edge(0, 3);
+    graph.add_edge(4, 3);
+
+    auto ranks = pagerank(graph, 0.85, 1e-12, 200, 2);
+    auto expected = expected_ranks(graph);
+
+    REQUIRE(std::accumulate(ranks.begin(), ranks.end(), 0.0) == Approx(1));
+    for (unsigned long v = 0; v < graph.num_vertices(); ++v) {
+      REQUIRE(ranks[v] == Approx(expected[v]));
+    }
+  }
+
+  SECTION("runs in single precision on a compressed sparse row") {
+    auto ranks = pagerank<float>(make_transposed_csr(graph));
+
+    REQUIRE(ranks.size() == 3);
+    REQUIRE(ranks[2] == Approx(1.0f / 3));
+  }
+}
+
+TEST_CASE("Personalized PageRank for undirected matrix graph",
+          "[pagerank][matrix_graph][undirected]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 3);
+  graph.add_vertex(4);
+
+  SECTION("teleports only to the given vertices") {
+    std::vector<double> personalization{2, 0, 0, 0, 0};
+
+    auto ranks = personalized_pagerank(graph, personalization, 0.85, 1e-12);
+    auto expected = expected_ranks(graph, {1, 0, 0, 0, 0});
+
+    REQUIRE(ranks[4] == 0);
+    REQUIRE(ranks[0] > ranks[3]);
+    for (unsigned long v = 0; v < graph.num_vertices(); ++v) {
+      REQUIRE(ranks[v] == Approx(expected[v]));
+    }
+  }
+
+  SECTION("rejects invalid weights") {
+    REQUIRE_THROWS_AS(
+        personalized_pagerank(graph, std::vector<double>{0, 0, 0, 0, 0}),
+        exceptions::InvariantViolationException);
+    REQUIRE_THROWS_AS(
+        personalized_pagerank(graph, std::vector<double>{1, -1, 0, 0, 0}),
+        exceptions::InvariantViolationException);
+    REQUIRE_THROWS_AS(personalized_pagerank(graph, std::vector<double>{1}),
+                      exceptions::InvariantViolationException);
+  }
+}
+
+TEST_CASE("PageRank for random graphs", "[pagerank][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  const unsigned long num_vertices = 10000;
+  std::mt19937 generator(37);
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+
+  Graph graph{};
+  graph.add_vertex(num_vertices - 1);
+  for (size_t i = 0; i < 30000; ++i) {
+    graph.add_edge(pick(generator), pick(generator));
+  }
+
+  SECTION("agrees with a serial power iteration") {
+    auto ranks = pagerank(graph, 0.85, 1e-12, 200, 4);
+    auto expected = expected_ranks(graph);
+
+    for (unsigned long v = 0; v < num_vertices; ++v) {
+      REQUIRE(ranks[v] == Approx(expected[v]).epsilon(1e-6));
+    }
+  }
+}
+
+} // namespace pagerank_test
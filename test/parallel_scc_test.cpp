@@ -0,0 +1,163 @@
+/**
+ * @file This file contains the unit tests for the parallel strongly connected
+ * components algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+#include "parallel_scc.hpp"
+#include "tarjan.hpp"
+
+#include <random>
+#include <vector>
+
+namespace parallel_scc_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+TEST_CASE("Parallel strongly connected components for directed list graph",
+          "[parallel_scc][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d, e, f };
+
+  graph.add_edge(a, b);
+  graph.add_edge(b, c);
+  graph.add_edge(c, a);
+  graph.add_edge(d, b);
+  graph.add_edge(d, c);
+  graph.add_edge(d, e);
+  graph.add_edge(e, d);
+  graph.add_edge(e, f);
+
+  /*
+    A       B       C       D       E       F
+    |------->
+            |------->
+    <---------------|
+            <-------<-------|------->
+                            <-------|------->
+  */
+
+  SECTION("detects strongly connected components") {
+    auto components = parallel_scc(graph, 4);
+
+    REQUIRE(components.sizes.size() == 3);
+    REQUIRE(components.component ==
+            std::vector<unsigned long>{0, 0, 0, 1, 1, 2});
+    REQUIRE(components.sizes == std::vector<size_t>{3, 2, 1});
+  }
+
+  SECTION("converts to the same format of tarjan") {
+    auto scc = to_scc_vector(parallel_scc(graph, 4));
+
+    REQUIRE(scc.size() == 3);
+    REQUIRE(scc[0] == std::vector<unsigned long>{a, b, c});
+    REQUIRE(scc[1] == std::vector<unsigned long>{d, e});
+    REQUIRE(scc[2] == std::vector<unsigned long>{f});
+  }
+}
+
+TEST_CASE("Parallel strongly connected components for directed matrix graph",
+          "[parallel_scc][matrix_graph][directed]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d, e, f };
+
+  graph.add_edge(a, b);
+  graph.add_edge(b, c);
+  graph.add_edge(c, a);
+  graph.add_edge(d, b);
+  graph.add_edge(d, c);
+  graph.add_edge(d, e);
+  graph.add_edge(e, d);
+  graph.add_edge(e, f);
+
+  SECTION("detects strongly connected components") {
+    auto components = parallel_scc(graph, 1);
+
+    REQUIRE(components.component ==
+            std::vector<unsigned long>{0, 0, 0, 1, 1, 2});
+  }
+}
+
+TEST_CASE("Parallel strongly connected components for undirected list graph",
+          "[parallel_scc][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d, e, f };
+
+  graph.add_edge(a, b);
+  graph.add_edge(b, c);
+  graph.add_edge(d, e);
+  graph.add_vertex(f);
+
+  SECTION("every connected component is strongly connected") {
+    auto components = parallel_scc(graph, 4);
+
+    REQUIRE(components.component ==
+            std::vector<unsigned long>{0, 0, 0, 1, 1, 2});
+  }
+}
+
+TEST_CASE("Parallel strongly connected components agree with tarjan",
+          "[parallel_scc][list_graph][random]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  std::mt19937 engine{42};
+  std::uniform_int_distribution<unsigned long> distribution{0, 999};
+
+  for (int edges : {500, 1500, 3000}) {
+    Graph graph{};
+    graph.add_vertex(999);
+    for (int i = 0; i < edges; ++i) {
+      graph.add_edge(distribution(engine), distribution(engine));
+    }
+
+    auto scc = tarjan(graph);
+    auto components = parallel_scc(graph, 4);
+
+    // Every tarjan component is mapped on a single component, and the number
+    // of components is the same, so the two partitions are the same
+    REQUIRE(components.sizes.size() == scc.size());
+    for (auto &&vertices : scc) {
+      for (auto vertex : vertices) {
+        REQUIRE(components.component[vertex] ==
+                components.component[vertices[0]]);
+      }
+    }
+  }
+}
+} // namespace parallel_scc_test
@@ -0,0 +1,140 @@
+/**
+ * @file This file is the test file of the Prim algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "kruskal.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+#include "prim.hpp"
+
+#include <random>
+
+namespace prim_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+TEST_CASE("Prim minimum spanning tree for undirected list graph",
+          "[prim][list_graph][undirected]") {
+  using Graph =
+      AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED, int>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d };
+
+  graph.add_edge(a, b, {2});
+  graph.add_edge(a, c, {1});
+  graph.add_edge(a, d, {4});
+  graph.add_edge(b, c, {3});
+  graph.add_edge(c, d, {9});
+
+  /*
+      A       B       C       D
+      |-------|
+              |-------|
+      |---------------|-------|
+      |-----------------------|
+  */
+
+  SECTION("check if edges founded are correct") {
+    auto vector = prim(graph);
+
+    REQUIRE(vector.size() == 3);
+    REQUIRE(graph.get_source(vector[0]) == a);
+    REQUIRE(graph.get_target(vector[0]) == c);
+    REQUIRE(graph.get_source(vector[1]) == a);
+    REQUIRE(graph.get_target(vector[1]) == b);
+    REQUIRE(graph.get_source(vector[2]) == a);
+    REQUIRE(graph.get_target(vector[2]) == d);
+  }
+
+  SECTION("check if no spanning tree in worst case") {
+    Graph graph2{};
+
+    graph2.add_edge(a, a, {1});
+
+    auto vector = prim(graph2);
+
+    REQUIRE(vector.size() == 0);
+  }
+
+  SECTION("more than one tree in the forest") {
+    Graph graph2{};
+    graph2.add_edge(0, 1, {1});
+    graph2.add_edge(2, 1, {2});
+    graph2.add_edge(3, 4, {3});
+    graph2.add_edge(5, 4, {5});
+
+    auto edges = prim(graph2);
+
+    REQUIRE(edges.size() == 4);
+    REQUIRE(graph2.get_target(edges[0]) == 1);
+    REQUIRE(graph2.get_target(edges[1]) == 2);
+    REQUIRE(graph2.get_target(edges[2]) == 4);
+    REQUIRE(graph2.get_target(edges[3]) == 5);
+  }
+}
+
+TEST_CASE("Prim minimum spanning tree for undirected matrix graph",
+          "[prim][matrix_graph][undirected]") {
+  using Graph =
+      AdjacencyMatrixGraph<unsigned long, Directedness::UNDIRECTED, int>;
+  Graph graph{};
+  std::mt19937 generator(31);
+  std::uniform_int_distribution<int> pick_weight(0, 100);
+
+  const unsigned long num_vertices = 60;
+  for (unsigned long u = 0; u < num_vertices; ++u) {
+    for (unsigned long v = u + 1; v < num_vertices; ++v) {
+      graph.add_edge(u, v, {pick_weight(generator)});
+    }
+  }
+
+  SECTION("has the same weight of the kruskal tree") {
+    auto expected = kruskal(graph);
+    auto actual = prim(graph);
+
+    long expected_weight = 0;
+    for (auto &edge : expected) {
+      expected_weight += std::get<2>(edge);
+    }
+    long actual_weight = 0;
+    for (auto &edge : actual) {
+      actual_weight += std::get<2>(edge);
+    }
+
+    REQUIRE(actual.size() == num_vertices - 1);
+    REQUIRE(actual_weight == expected_weight);
+  }
+}
+
+} // namespace prim_test
@@ -0,0 +1,212 @@
+/**
+ * @file This file is the test file of the random walks generator
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "exceptions.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+#include "random_walks.hpp"
+
+#include <cmath>
+#include <mutex>
+#include <span>
+#include <tuple>
+#include <vector>
+
+namespace random_walks_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+// Checks that every walk starts from its vertex and follows edges
+template <typename G>
+void require_walks(const G &graph,
+                   const RandomWalks<unsigned long> &result,
+                   size_t walk_length, size_t num_walks) {
+  REQUIRE(result.offsets.size() == num_walks + 1);
+  REQUIRE(result.offsets.back() == result.vertices.size());
+  bool valid = true;
+  for (size_t i = 0; i < num_walks; ++i) {
+    size_t first = result.offsets[i];
+    size_t last = result.offsets[i + 1];
+    valid = valid && last > first && last - first <= walk_length &&
+            result.vertices[first] == i % graph.num_vertices();
+    for (size_t j = first + 1; valid && j < last; ++j) {
+      valid = graph.has_edge(result.vertices[j - 1], result.vertices[j]);
+    }
+  }
+  REQUIRE(valid);
+}
+
+TEST_CASE("Uniform random walks for directed list graph",
+          "[random_walks][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  // A cycle 0 -> 1 -> 2 -> 0 with a chord, and a path 3 -> 4 -> 5
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 0);
+  graph.add_edge(0, 2);
+  graph.add_edge(3, 4);
+  graph.add_edge(4, 5);
+
+  RandomWalker walker(graph);
+
+  SECTION("walks follow the edges and stop at dead ends") {
+    auto result = walker.walks(8, 3, 1);
+
+    require_walks(graph, result, 8, 18);
+    for (size_t i = 0; i < 18; ++i) {
+      size_t length = result.offsets[i + 1] - result.offsets[i];
+      size_t expected = i % 6 < 3 ? 8 : 6 - i % 6;
+      REQUIRE(length == expected);
+    }
+  }
+
+  SECTION("walks do not depend on the number of threads") {
+    auto serial = walker.walks(20, 50, 7, 1);
+    auto parallel = walker.walks(20, 50, 7, 4);
+
+    REQUIRE(serial.vertices == parallel.vertices);
+    REQUIRE(serial.offsets == parallel.offsets);
+    REQUIRE(walker.walks(20, 50, 8, 1).vertices != serial.vertices);
+  }
+
+  SECTION("a sink receives the same walks") {
+    auto expected = walker.walks(10, 4, 3);
+    std::vector<std::vector<unsigned long>> received(24);
+    std::mutex mutex;
+    walker.walks(
+        10, 4,
+        [&](size_t index, std::span<const unsigned long> walk) {
+          std::lock_guard lock(mutex);
+          received[index].assign(walk.begin(), walk.end());
+        },
+        3, 4);
+
+    for (size_t i = 0; i < 24; ++i) {
+      REQUIRE(received[i] ==
+              std::vector<unsigned long>(
+                  expected.vertices.begin() + expected.offsets[i],
+                  expected.vertices.begin() + expected.offsets[i + 1]));
+    }
+  }
+}
+
+TEST_CASE("Weighted random walks for directed matrix graph",
+          "[random_walks][matrix_graph][directed]") {
+  using Graph =
+      AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED, double>;
+  Graph graph{};
+
+  graph.add_edge(0, 1, {1.0});
+  graph.add_edge(0, 2, {3.0});
+  graph.add_edge(0, 3, {0.0});
+  graph.add_edge(1, 0, {1.0});
+  graph.add_edge(2, 0, {1.0});
+  graph.add_edge(3, 0, {1.0});
+
+  auto weight = [](const auto &edge) { return std::get<2>(edge); };
+  RandomWalker walker(graph, weight);
+
+  SECTION("transitions are proportional to the weights") {
+    auto result = walker.walks(2, 20000, 11);
+    require_walks(graph, result, 2, 80000);
+
+    size_t to_one = 0;
+    size_t to_two = 0;
+    for (size_t i = 0; i < 80000; i += 4) {
+      auto second = result.vertices[result.offsets[i] + 1];
+      REQUIRE(second != 3);
+      to_one += second == 1;
+      to_two += second == 2;
+    }
+    REQUIRE(std::abs(static_cast<double>(to_one) / 20000 - 0.25) < 0.02);
+    REQUIRE(std::abs(static_cast<double>(to_two) / 20000 - 0.75) < 0.02);
+  }
+
+  SECTION("rejects negative weights") {
+    graph.add_edge(1, 2, {-1.0});
+    REQUIRE_THROWS_AS(RandomWalker(graph, weight),
+                      exceptions::InvariantViolationException);
+  }
+}
+
+TEST_CASE("Node2vec random walks for undirected list graph",
+          "[random_walks][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  // From 0 to 1, the next vertex is 0 (return), 2 (adjacent to 0) or 3
+  graph.add_edge(0, 1);
+  graph.add_edge(0, 2);
+  graph.add_edge(1, 2);
+  graph.add_edge(1, 3);
+
+  RandomWalker walker(graph);
+
+  SECTION("second steps follow the return and in-out biases") {
+    auto result = walker.node2vec_walks(3, 40000, 2, 0.5, 5);
+    require_walks(graph, result, 3, 160000);
+
+    std::vector<double> counts(4, 0);
+    double total = 0;
+    for (size_t i = 0; i < 160000; i += 4) {
+      size_t first = result.offsets[i];
+      if (result.vertices[first + 1] == 1) {
+        ++counts[result.vertices[first + 2]];
+        ++total;
+      }
+    }
+    // Biases 1 / p, 1 and 1 / q
+    REQUIRE(std::abs(counts[0] / total - 1.0 / 7) < 0.02);
+    REQUIRE(std::abs(counts[2] / total - 2.0 / 7) < 0.02);
+    REQUIRE(std::abs(counts[3] / total - 4.0 / 7) < 0.02);
+  }
+
+  SECTION("unit parameters give first order walks") {
+    auto first_order = walker.walks(10, 5, 9);
+    auto second_order = walker.node2vec_walks(10, 5, 1, 1, 9);
+
+    REQUIRE(first_order.vertices == second_order.vertices);
+  }
+
+  SECTION("rejects non positive parameters") {
+    REQUIRE_THROWS_AS(walker.node2vec_walks(10, 5, 0, 1),
+                      exceptions::InvariantViolationException);
+    REQUIRE_THROWS_AS(walker.node2vec_walks(10, 5, 1, -1),
+                      exceptions::InvariantViolationException);
+  }
+}
+
+} // namespace random_walks_test
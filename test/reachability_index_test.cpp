@@ -0,0 +1,191 @@
+/**
+ * @file This file contains the unit tests for the reachability index
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "bfs.hpp"
+#include "catch.hpp"
+#include "list_graph.hpp"
+#include "reachability_index.hpp"
+#include "utils/parallel_utils.hpp"
+
+#include <atomic>
+#include <random>
+#include <vector>
+
+namespace reachability_index_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+template <typename Graph>
+void require_same_as_bfs(const Graph &graph,
+                         const ReachabilityIndex<Graph> &index) {
+  for (Vertex<Graph> source = 0; source < graph.num_vertices(); ++source) {
+    auto tree = bfs(graph, source);
+    for (Vertex<Graph> target = 0; target < graph.num_vertices(); ++target) {
+      REQUIRE(index.reachable(source, target) ==
+              (tree[target].status == VertexStatus::PROCESSED));
+    }
+  }
+}
+
+TEST_CASE("Reachability index for directed list graph",
+          "[reachability_index][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d, e, f, g };
+
+  graph.add_edge(a, b);
+  graph.add_edge(b, c);
+  graph.add_edge(c, a);
+  graph.add_edge(d, b);
+  graph.add_edge(d, e);
+  graph.add_edge(e, d);
+  graph.add_edge(e, f);
+  graph.add_vertex(g);
+
+  SECTION("answers reachability queries") {
+    ReachabilityIndex index(graph, 3, 0, 4);
+
+    REQUIRE(index.num_components() == 4);
+    REQUIRE(index.reachable(a, c));
+    REQUIRE(index.reachable(c, b));
+    REQUIRE(index.reachable(d, a));
+    REQUIRE(index.reachable(e, f));
+    REQUIRE_FALSE(index.reachable(a, d));
+    REQUIRE_FALSE(index.reachable(f, e));
+    REQUIRE_FALSE(index.reachable(g, a));
+    REQUIRE_FALSE(index.reachable(a, g));
+  }
+
+  SECTION("every vertex reaches itself") {
+    ReachabilityIndex index(graph, 1, 0, 1);
+
+    for (unsigned long vertex = a; vertex <= g; ++vertex) {
+      REQUIRE(index.reachable(vertex, vertex));
+    }
+  }
+
+  SECTION("works without intervals") {
+    ReachabilityIndex index(graph, 0, 0, 1);
+
+    require_same_as_bfs(graph, index);
+  }
+}
+
+TEST_CASE("Reachability index for undirected list graph",
+          "[reachability_index][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(3, 4);
+
+  SECTION("vertices reach their connected component") {
+    ReachabilityIndex index(graph, 2, 0, 2);
+
+    REQUIRE(index.num_components() == 2);
+    require_same_as_bfs(graph, index);
+  }
+}
+
+TEST_CASE("Reachability index of random graphs",
+          "[reachability_index][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  constexpr unsigned long size = 300;
+  std::mt19937 generator(50);
+  std::uniform_int_distribution<unsigned long> pick(0, size - 1);
+
+  SECTION("matches a breadth first visit from every vertex") {
+    for (size_t edges_per_vertex : {1, 2, 4}) {
+      Graph graph{};
+      graph.add_vertex(size - 1);
+      for (size_t i = 0; i < edges_per_vertex * size / 2; ++i) {
+        graph.add_edge(pick(generator), pick(generator));
+      }
+
+      for (size_t num_labels : {1, 5}) {
+        require_same_as_bfs(graph,
+                            ReachabilityIndex(graph, num_labels, 7, 4));
+      }
+    }
+  }
+
+  SECTION("matches a breadth first visit on directed acyclic graphs") {
+    Graph graph{};
+    graph.add_vertex(size - 1);
+    for (size_t i = 0; i < size * 2; ++i) {
+      unsigned long source = pick(generator);
+      unsigned long target = pick(generator);
+      if (source < target) {
+        graph.add_edge(source, target);
+      }
+    }
+
+    ReachabilityIndex index(graph, 3, 1, 2);
+    REQUIRE(index.num_components() == size);
+    require_same_as_bfs(graph, index);
+  }
+
+  SECTION("answers queries concurrently") {
+    Graph graph{};
+    graph.add_vertex(size - 1);
+    for (size_t i = 0; i < size; ++i) {
+      graph.add_edge(pick(generator), pick(generator));
+    }
+    ReachabilityIndex index(graph, 2, 0, 4);
+
+    std::vector<std::vector<bool>> expected(size);
+    for (unsigned long source = 0; source < size; ++source) {
+      auto tree = bfs(graph, source);
+      for (unsigned long target = 0; target < size; ++target) {
+        expected[source].push_back(tree[target].status ==
+                                   VertexStatus::PROCESSED);
+      }
+    }
+
+    std::atomic<size_t> mismatches = 0;
+    utils::parallel_for(
+        size_t{0}, size * size,
+        [&](size_t query) {
+          size_t source = query / size;
+          size_t target = query % size;
+          if (index.reachable(source, target) != expected[source][target]) {
+            ++mismatches;
+          }
+        },
+        4, size_t{64});
+    REQUIRE(mismatches == 0);
+  }
+}
+} // namespace reachability_index_test
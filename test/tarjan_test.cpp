@@ -192,4 +192,30 @@ TEST_CASE(
     REQUIRE(scc.size() == 1);
   }
 }
+
+TEST_CASE("Tarjan for strongly connected components on a very deep graph",
+          "[tarjan][list_graph][deep]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  constexpr size_t length = 500000;
+  for (size_t vertex = 0; vertex + 1 < length; vertex++) {
+    graph.add_edge(vertex, vertex + 1);
+  }
+
+  SECTION("a long path has only singleton components") {
+    auto scc = tarjan(graph);
+
+    REQUIRE(scc.size() == length);
+    REQUIRE(scc[0][0] == length - 1);
+  }
+
+  SECTION("closing the path creates a single component") {
+    graph.add_edge(length - 1, 0);
+    auto scc = tarjan(graph);
+
+    REQUIRE(scc.size() == 1);
+    REQUIRE(scc[0].size() == length);
+  }
+}
 } // namespace tarjan_test
\ No newline at end of file
@@ -0,0 +1,163 @@
+/**
+ * @file This file is the test file of the topological sort algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "catch.hpp"
+#include "exceptions.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+#include "topological_sort.hpp"
+
+#include <random>
+#include <vector>
+
+namespace topological_sort_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+// Checks that every edge goes forward in the order
+template <typename G>
+void require_topological(const G &graph,
+                         const std::vector<unsigned long> &order) {
+  REQUIRE(order.size() == graph.num_vertices());
+  std::vector<size_t> position(order.size(), order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    position[order[i]] = i;
+  }
+  for (unsigned long v = 0; v < graph.num_vertices(); ++v) {
+    REQUIRE(position[v] < order.size());
+    for (auto &edge : graph[v]) {
+      REQUIRE(position[v] < position[graph.get_target(edge)]);
+    }
+  }
+}
+
+TEST_CASE("Topological sort for directed list graph",
+          "[topological_sort][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(3, 1);
+  graph.add_edge(1, 0);
+  graph.add_edge(3, 0);
+  graph.add_edge(2, 0);
+  graph.add_vertex(4);
+
+  SECTION("outputs every vertex after its predecessors") {
+    auto order = topological_sort(graph);
+
+    REQUIRE(order == std::vector<unsigned long>{2, 3, 4, 1, 0});
+  }
+
+  SECTION("groups the vertices by level") {
+    auto levels = topological_levels(graph, 2);
+
+    REQUIRE(levels.offsets == std::vector<size_t>{0, 3, 4, 5});
+    REQUIRE(levels.order[3] == 1);
+    REQUIRE(levels.order[4] == 0);
+    require_topological(graph, levels.order);
+  }
+
+  SECTION("throws on cycles") {
+    graph.add_edge(0, 3);
+
+    REQUIRE_THROWS_AS(topological_sort(graph),
+                      exceptions::InvariantViolationException);
+    REQUIRE_THROWS_AS(topological_levels(graph),
+                      exceptions::InvariantViolationException);
+  }
+}
+
+TEST_CASE("Topological sort for directed matrix graph",
+          "[topological_sort][matrix_graph][directed]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 2);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 3);
+
+  SECTION("outputs every vertex after its predecessors") {
+    require_topological(graph, topological_sort(graph));
+    require_topological(graph, topological_levels(graph).order);
+  }
+}
+
+TEST_CASE("Topological sort for random directed acyclic graphs",
+          "[topological_sort][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  const unsigned long num_vertices = 5000;
+  std::mt19937 generator(41);
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+
+  // Edges go from a smaller to a larger label of a random permutation
+  std::vector<unsigned long> label(num_vertices);
+  for (unsigned long v = 0; v < num_vertices; ++v) {
+    label[v] = v;
+  }
+  std::shuffle(label.begin(), label.end(), generator);
+
+  Graph graph{};
+  graph.add_vertex(num_vertices - 1);
+  for (size_t i = 0; i < 20000; ++i) {
+    auto u = pick(generator);
+    auto v = pick(generator);
+    if (u < v) {
+      graph.add_edge(label[u], label[v]);
+    }
+  }
+
+  SECTION("serial and parallel orders are topological") {
+    require_topological(graph, topological_sort(graph));
+
+    auto levels = topological_levels(graph, 4);
+    require_topological(graph, levels.order);
+
+    // A vertex is on the level after its deepest predecessor
+    std::vector<size_t> level(num_vertices);
+    for (size_t i = 0; i + 1 < levels.offsets.size(); ++i) {
+      for (size_t j = levels.offsets[i]; j < levels.offsets[i + 1]; ++j) {
+        level[levels.order[j]] = i;
+      }
+    }
+    std::vector<size_t> expected(num_vertices, 0);
+    for (auto v : topological_sort(graph)) {
+      for (auto &edge : graph[v]) {
+        auto &target = expected[graph.get_target(edge)];
+        target = std::max(target, expected[v] + 1);
+      }
+    }
+    REQUIRE(level == expected);
+  }
+}
+
+} // namespace topological_sort_test
@@ -0,0 +1,182 @@
+/**
+ * @file This file contains the unit tests for the transitive closure
+ * algorithm
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "base.hpp"
+#include "bfs.hpp"
+#include "catch.hpp"
+#include "list_graph.hpp"
+#include "parallel_scc.hpp"
+#include "transitive_closure.hpp"
+
+#include <random>
+#include <vector>
+
+namespace transitive_closure_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+template <typename Graph>
+void require_same_as_bfs(const Graph &graph,
+                         const TransitiveClosure<Vertex<Graph>> &closure) {
+  for (Vertex<Graph> source = 0; source < graph.num_vertices(); ++source) {
+    auto tree = bfs(graph, source);
+    for (Vertex<Graph> target = 0; target < graph.num_vertices(); ++target) {
+      REQUIRE(closure.reachable(source, target) ==
+              (tree[target].status == VertexStatus::PROCESSED));
+    }
+  }
+}
+
+TEST_CASE("Transitive closure for directed list graph",
+          "[transitive_closure][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  enum vertices { a, b, c, d, e, f, g };
+
+  graph.add_edge(a, b);
+  graph.add_edge(b, c);
+  graph.add_edge(c, a);
+  graph.add_edge(d, b);
+  graph.add_edge(d, e);
+  graph.add_edge(e, d);
+  graph.add_edge(e, f);
+  graph.add_vertex(g);
+
+  SECTION("answers reachability queries") {
+    auto closure = transitive_closure(graph, 4);
+
+    REQUIRE(closure.num_components == 4);
+    REQUIRE(closure.words_per_row == 1);
+    REQUIRE(closure.reachable(a, c));
+    REQUIRE(closure.reachable(c, b));
+    REQUIRE(closure.reachable(d, a));
+    REQUIRE(closure.reachable(e, f));
+    REQUIRE_FALSE(closure.reachable(a, d));
+    REQUIRE_FALSE(closure.reachable(f, e));
+    REQUIRE_FALSE(closure.reachable(g, a));
+    REQUIRE_FALSE(closure.reachable(a, g));
+  }
+
+  SECTION("every vertex reaches itself") {
+    auto closure = transitive_closure(graph, 1);
+
+    for (unsigned long vertex = a; vertex <= g; ++vertex) {
+      REQUIRE(closure.reachable(vertex, vertex));
+    }
+  }
+
+  SECTION("reuses given components") {
+    auto components = parallel_scc(graph, 1);
+    auto closure = transitive_closure(graph, components, 1);
+
+    REQUIRE(closure.component == components.component);
+    require_same_as_bfs(graph, closure);
+  }
+}
+
+TEST_CASE("Transitive closure of a long path",
+          "[transitive_closure][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+  constexpr unsigned long length = 200;
+
+  for (unsigned long vertex = 0; vertex + 1 < length; ++vertex) {
+    graph.add_edge(vertex, vertex + 1);
+  }
+
+  SECTION("vertices reach exactly the following ones") {
+    auto closure = transitive_closure(graph, 4);
+
+    REQUIRE(closure.num_components == length);
+    REQUIRE(closure.words_per_row == 4);
+    for (unsigned long source = 0; source < length; ++source) {
+      for (unsigned long target = 0; target < length; ++target) {
+        REQUIRE(closure.reachable(source, target) == (source <= target));
+      }
+    }
+  }
+}
+
+TEST_CASE("Transitive closure for undirected list graph",
+          "[transitive_closure][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(3, 4);
+
+  SECTION("vertices reach their connected component") {
+    auto closure = transitive_closure(graph, 2);
+
+    REQUIRE(closure.num_components == 2);
+    require_same_as_bfs(graph, closure);
+  }
+}
+
+TEST_CASE("Transitive closure of random graphs",
+          "[transitive_closure][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  std::mt19937 generator(49);
+
+  SECTION("matches a breadth first visit from every vertex") {
+    for (size_t edges_per_vertex : {1, 2, 4}) {
+      Graph graph{};
+      constexpr unsigned long size = 300;
+      std::uniform_int_distribution<unsigned long> pick(0, size - 1);
+      graph.add_vertex(size - 1);
+      for (size_t i = 0; i < edges_per_vertex * size / 2; ++i) {
+        graph.add_edge(pick(generator), pick(generator));
+      }
+
+      for (size_t num_threads : {1, 4}) {
+        require_same_as_bfs(graph, transitive_closure(graph, num_threads));
+      }
+    }
+  }
+}
+
+TEST_CASE("Transitive closure of empty graph",
+          "[transitive_closure][list_graph][directed]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  SECTION("has no components") {
+    auto closure = transitive_closure(graph, 4);
+
+    REQUIRE(closure.num_components == 0);
+    REQUIRE(closure.bits.empty());
+  }
+}
+} // namespace transitive_closure_test
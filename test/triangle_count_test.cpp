@@ -0,0 +1,137 @@
+/**
+ * @file This file is the test file of the triangle counting algorithms
+ *
+ * @copyright Copyright © 2023 Matteo Cavaliere, Cristiano Di Bari, Michele
+ * Quaresmini, Andrea Cinelli. All rights reserved.
+ *
+ * @license{<blockquote>
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * </blockquote>}
+ *
+ * @author Matteo Cavaliere, Cristiano Di Bari, Michele Quaresmini, Andrea
+ * Cinelli
+ * @date December, 2022
+ * @version v1.0
+ */
+
+#include "adaptors/compressed_sparse_row.hpp"
+#include "base.hpp"
+#include "catch.hpp"
+#include "list_graph.hpp"
+#include "matrix_graph.hpp"
+#include "triangle_count.hpp"
+
+#include <random>
+#include <vector>
+
+namespace triangle_count_test {
+using namespace graphxx;
+using namespace graphxx::algorithms;
+
+TEST_CASE("Triangle count for undirected list graph",
+          "[triangle_count][list_graph][undirected]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  Graph graph{};
+
+  // A complete graph on 0..3 and a pendant vertex
+  graph.add_edge(0, 1);
+  graph.add_edge(0, 2);
+  graph.add_edge(0, 3);
+  graph.add_edge(1, 2);
+  graph.add_edge(1, 3);
+  graph.add_edge(2, 3);
+  graph.add_edge(3, 4);
+
+  SECTION("counts every triangle once") {
+    REQUIRE(triangle_count(graph, 2) == 4);
+  }
+
+  SECTION("counts the triangles of every vertex") {
+    REQUIRE(vertex_triangle_counts(graph, 2) ==
+            std::vector<size_t>{3, 3, 3, 3, 0});
+  }
+
+  SECTION("computes local clustering coefficients") {
+    auto coefficients = clustering_coefficients(graph);
+
+    REQUIRE(coefficients[0] == 1);
+    REQUIRE(coefficients[3] == Approx(0.5));
+    REQUIRE(coefficients[4] == 0);
+  }
+}
+
+TEST_CASE("Triangle count for directed matrix graph",
+          "[triangle_count][matrix_graph][directed]") {
+  using Graph = AdjacencyMatrixGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 0);
+  graph.add_edge(1, 2);
+  graph.add_edge(0, 2);
+  graph.add_edge(2, 2);
+
+  SECTION("ignores directions, parallel edges and self loops") {
+    REQUIRE(triangle_count(graph) == 1);
+    REQUIRE(vertex_triangle_counts(graph) == std::vector<size_t>{1, 1, 1});
+  }
+}
+
+TEST_CASE("Triangle count for random graphs",
+          "[triangle_count][list_graph]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::UNDIRECTED>;
+  const unsigned long num_vertices = 300;
+  std::mt19937 generator(38);
+  std::uniform_int_distribution<unsigned long> pick(0, num_vertices - 1);
+
+  Graph graph{};
+  graph.add_vertex(num_vertices - 1);
+  for (size_t i = 0; i < 6000; ++i) {
+    auto u = pick(generator);
+    auto v = pick(generator);
+    if (u != v) {
+      graph.add_edge(u, v);
+    }
+  }
+
+  SECTION("agrees with a brute force count on the compressed sparse row") {
+    std::vector<size_t> expected(num_vertices, 0);
+    size_t expected_total = 0;
+    for (unsigned long u = 0; u < num_vertices; ++u) {
+      for (unsigned long v = u + 1; v < num_vertices; ++v) {
+        for (unsigned long w = v + 1; w < num_vertices; ++w) {
+          if (graph.has_edge(u, v) && graph.has_edge(v, w) &&
+              graph.has_edge(u, w)) {
+            ++expected[u];
+            ++expected[v];
+            ++expected[w];
+            ++expected_total;
+          }
+        }
+      }
+    }
+
+    auto symmetric = make_symmetric_csr(graph);
+
+    REQUIRE(triangle_count(symmetric, 4) == expected_total);
+    REQUIRE(vertex_triangle_counts(symmetric, 4) == expected);
+  }
+}
+
+} // namespace triangle_count_test
@@ -30,12 +30,26 @@
  * @version v1.0
  */
 
+#include "adaptors/compressed_sparse_row.hpp"
 #include "build_path.hpp"
 #include "catch.hpp"
 #include "exceptions.hpp"
+#include "indexed_heap.hpp"
+#include "list_graph.hpp"
+#include "parallel_utils.hpp"
+#include "random_utils.hpp"
+#include "simd_utils.hpp"
 #include "string_utils.hpp"
 #include "tuple"
 #include "tuple_utils.hpp"
+#include "union_find.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
 
 namespace utils_test {
 using namespace graphxx;
@@ -101,4 +115,305 @@ TEST_CASE("build correct path", "[build_path]") {
     REQUIRE(res[3].parent == 3);
   }
 }
+
+TEST_CASE("Parallel utils", "[parallel_utils]") {
+  SECTION("every index is visited exactly once") {
+    std::vector<std::atomic<int>> visits(10000);
+
+    utils::parallel_for(
+        size_t{0}, visits.size(), [&](size_t i) { ++visits[i]; }, 4,
+        size_t{7});
+
+    for (auto &visit : visits) {
+      REQUIRE(visit == 1);
+    }
+  }
+
+  SECTION("collects the outputs of all the threads") {
+    auto even = utils::parallel_collect<int>(
+        0, 1000,
+        [](int i, std::vector<int> &output) {
+          if (i % 2 == 0) {
+            output.push_back(i);
+          }
+        },
+        4, 10);
+
+    std::sort(even.begin(), even.end());
+    REQUIRE(even.size() == 500);
+    REQUIRE(even[499] == 998);
+  }
+
+  SECTION("sorts in parallel") {
+    std::vector<int> values(100000);
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = static_cast<int>((i * 7919) % 100003);
+    }
+    auto expected = values;
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+    utils::parallel_sort(values.begin(), values.end(), std::greater<>{}, 3,
+                         1000);
+
+    REQUIRE(values == expected);
+  }
+
+  SECTION("rethrows exceptions thrown by the threads") {
+    REQUIRE_THROWS_AS(utils::parallel_for(
+                          0, 1000,
+                          [](int i) {
+                            if (i == 500) {
+                              throw std::runtime_error("parallel error");
+                            }
+                          },
+                          4, 10),
+                      std::runtime_error);
+  }
+}
+
+TEST_CASE("Indexed heap", "[indexed_heap]") {
+  utils::IndexedHeap<int> heap(10);
+
+  heap.push(3, 30);
+  heap.push(5, 50);
+  heap.push(7, 70);
+  heap.push(1, 10);
+
+  SECTION("pops keys by increasing priority") {
+    REQUIRE(heap.size() == 4);
+    REQUIRE(heap.top() == 1);
+    REQUIRE(heap.top_priority() == 10);
+    REQUIRE(heap.pop() == 1);
+    REQUIRE(heap.pop() == 3);
+    REQUIRE(heap.pop() == 5);
+    REQUIRE(heap.pop() == 7);
+    REQUIRE(heap.empty());
+  }
+
+  SECTION("decreases priorities in place") {
+    REQUIRE(heap.push_or_decrease(7, 5));
+    REQUIRE_FALSE(heap.push_or_decrease(5, 60));
+    REQUIRE(heap.push_or_decrease(9, 20));
+
+    REQUIRE(heap.size() == 5);
+    REQUIRE(heap.pop() == 7);
+    REQUIRE(heap.priority(7) == 5);
+    REQUIRE_FALSE(heap.contains(7));
+    REQUIRE(heap.pop() == 1);
+    REQUIRE(heap.pop() == 9);
+  }
+
+  SECTION("can be cleared and reused") {
+    heap.clear();
+
+    REQUIRE(heap.empty());
+    REQUIRE_FALSE(heap.contains(3));
+
+    heap.push(3, 1);
+    REQUIRE(heap.top() == 3);
+  }
+}
+
+TEST_CASE("Concurrent union-find", "[union_find]") {
+  utils::ConcurrentUnionFind<unsigned long> sets(10);
+
+  SECTION("merges sets keeping the smallest element as representative") {
+    REQUIRE(sets.unite(7, 3));
+    REQUIRE(sets.unite(3, 9));
+    REQUIRE_FALSE(sets.unite(9, 7));
+
+    REQUIRE(sets.find(9) == 3);
+    REQUIRE(sets.connected(7, 9));
+    REQUIRE_FALSE(sets.connected(7, 8));
+  }
+
+  SECTION("grows with singleton sets") {
+    sets.unite(1, 2);
+    sets.resize(12);
+
+    REQUIRE(sets.size() == 12);
+    REQUIRE(sets.find(11) == 11);
+    REQUIRE(sets.find(2) == 1);
+  }
+
+  SECTION("supports concurrent unions") {
+    utils::ConcurrentUnionFind<unsigned long> chain(10000);
+    utils::parallel_for(
+        size_t{1}, chain.size(), [&](size_t i) { chain.unite(i - 1, i); }, 4,
+        size_t{16});
+
+    auto labels = chain.labels();
+    for (auto label : labels) {
+      REQUIRE(label == 0);
+    }
+  }
+}
+
+TEST_CASE("Compressed sparse row", "[compressed_sparse_row]") {
+  using Graph = AdjacencyListGraph<unsigned long, Directedness::DIRECTED>;
+  Graph graph{};
+
+  graph.add_edge(0, 2);
+  graph.add_edge(0, 1);
+  graph.add_edge(2, 1);
+  graph.add_vertex(3);
+
+  SECTION("out edges keep the adjacency order") {
+    auto csr = make_csr(graph);
+
+    REQUIRE(csr.num_vertices() == 4);
+    REQUIRE(csr.num_edges() == 3);
+    REQUIRE(csr.degree(0) == 2);
+    REQUIRE(csr[0][0] == 2);
+    REQUIRE(csr[0][1] == 1);
+    REQUIRE(csr.degree(3) == 0);
+    REQUIRE(csr.edge_id(2) == 2);
+  }
+
+  SECTION("in edges remember the original edges") {
+    auto csr = make_transposed_csr(graph);
+
+    REQUIRE(csr.num_edges() == 3);
+    REQUIRE(csr.degree(0) == 0);
+    REQUIRE(csr.degree(1) == 2);
+    REQUIRE(csr[1][0] == 0);
+    REQUIRE(csr[1][1] == 2);
+    REQUIRE(csr.edge_id(csr.offsets()[1]) == 1);
+    REQUIRE(csr.edge_id(csr.offsets()[1] + 1) == 2);
+    REQUIRE(csr[2][0] == 0);
+    REQUIRE(csr.edge_id(csr.offsets()[2]) == 0);
+  }
+
+  SECTION("symmetric rows are sorted and simple") {
+    graph.add_edge(1, 0);
+    graph.add_edge(3, 3);
+
+    auto csr = make_symmetric_csr(graph, 2);
+
+    REQUIRE(csr.num_edges() == 6);
+    REQUIRE(csr.degree(0) == 2);
+    REQUIRE(csr[0][0] == 1);
+    REQUIRE(csr[0][1] == 2);
+    REQUIRE(csr[1][0] == 0);
+    REQUIRE(csr[1][1] == 2);
+    REQUIRE(csr[2][0] == 0);
+    REQUIRE(csr.degree(3) == 0);
+  }
+}
+
+TEMPLATE_TEST_CASE("Sorted intersection", "[simd_utils]", uint32_t,
+                   uint64_t) {
+  std::mt19937 generator(38);
+
+  auto random_set = [&](size_t size, TestType range) {
+    std::uniform_int_distribution<TestType> pick(0, range);
+    std::vector<TestType> values(size);
+    for (auto &value : values) {
+      value = pick(generator);
+    }
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+  };
+
+  auto check = [](const std::vector<TestType> &lhs,
+                  const std::vector<TestType> &rhs) {
+    std::vector<TestType> expected;
+    std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                          std::back_inserter(expected));
+    std::vector<TestType> common(std::min(lhs.size(), rhs.size()));
+
+    REQUIRE(utils::intersection_size<TestType>(lhs, rhs) == expected.size());
+    common.resize(utils::intersection<TestType>(lhs, rhs, common.data()));
+    REQUIRE(common == expected);
+  };
+
+  SECTION("merges arrays of similar sizes") {
+    for (size_t size = 0; size < 100; ++size) {
+      check(random_set(size, 150), random_set(size + size / 3, 150));
+    }
+  }
+
+  SECTION("gallops through much longer arrays") {
+    for (size_t size = 1; size < 20; ++size) {
+      check(random_set(size, 5000), random_set(40 * size + 50, 5000));
+      check(random_set(50 * size, 5000), random_set(size, 5000));
+    }
+  }
+}
+
+TEST_CASE("Counter-based random number generator", "[random_utils]") {
+  SECTION("streams are reproducible and distinct") {
+    utils::CounterRng first(1, 0);
+    utils::CounterRng again(1, 0);
+    utils::CounterRng other_stream(1, 1);
+    utils::CounterRng other_seed(2, 0);
+    for (size_t i = 0; i < 100; ++i) {
+      auto value = first();
+      REQUIRE(value == again());
+      REQUIRE(value != other_stream());
+      REQUIRE(value != other_seed());
+    }
+  }
+
+  SECTION("bounded and uniform numbers") {
+    utils::CounterRng rng(3, 4);
+    std::vector<size_t> counts(7, 0);
+    for (size_t i = 0; i < 70000; ++i) {
+      auto value = rng.bounded(7);
+      REQUIRE(value < 7);
+      ++counts[value];
+      double real = rng.uniform();
+      REQUIRE(real >= 0);
+      REQUIRE(real < 1);
+    }
+    for (auto count : counts) {
+      REQUIRE(count > 9500);
+      REQUIRE(count < 10500);
+    }
+  }
+}
+
+TEST_CASE("Byte-wise maximum", "[simd_utils]") {
+  std::mt19937 generator(45);
+  std::uniform_int_distribution<unsigned> pick(0, 255);
+
+  SECTION("takes the maximum of every byte and reports growth") {
+    for (size_t size : {0, 1, 31, 32, 64, 100}) {
+      std::vector<uint8_t> target(size);
+      std::vector<uint8_t> source(size);
+      std::vector<uint8_t> expected(size);
+      for (size_t i = 0; i < size; ++i) {
+        target[i] = static_cast<uint8_t>(pick(generator));
+        source[i] = static_cast<uint8_t>(pick(generator));
+        expected[i] = std::max(target[i], source[i]);
+      }
+      bool grows = expected != target;
+
+      REQUIRE(utils::max_into(target, source) == grows);
+      REQUIRE(target == expected);
+      REQUIRE_FALSE(utils::max_into(target, source));
+    }
+  }
+}
+
+TEST_CASE("Word-wise or", "[simd_utils]") {
+  std::mt19937_64 generator(49);
+
+  SECTION("takes the union of two bitsets") {
+    for (size_t size : {0, 1, 3, 4, 8, 13}) {
+      std::vector<uint64_t> target(size);
+      std::vector<uint64_t> source(size);
+      std::vector<uint64_t> expected(size);
+      for (size_t i = 0; i < size; ++i) {
+        target[i] = generator();
+        source[i] = generator();
+        expected[i] = target[i] | source[i];
+      }
+
+      utils::or_into(target, source);
+      REQUIRE(target == expected);
+    }
+  }
+}
 } // namespace utils_test